@@ -63,85 +63,85 @@
 
 namespace BlockOperations
 {
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	using MergeFunction = array_size_t (*)(	T* array,
 								 	 	 	 array_size_t block_1_begin,
 											 array_size_t block_1_end,
 											 array_size_t block_2_begin,
 											 array_size_t block_2_end,
-											 SortMetrics *metrics);
+											 Metrics *metrics);
 
 	/*	Sorts an array from [begin:end] using an insertion sort
 	 * 	Parameter 'ignored' is provided to make its signature match
 	 * 	BlockMerging algorithms	*/
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	array_size_t insertionSortPartial(T* array,
 									  array_size_t begin,
 									  array_size_t ignored,
 									  array_size_t suspect,
 									  array_size_t end,
-									  SortMetrics *metrics = nullptr);
+									  Metrics *metrics = nullptr);
 
 	/* 	Blocks do not have to be continuous nor do they have to be the same size */
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	array_size_t mergeTwoBlocksElementsByTable(	T* array,
 											 	array_size_t block_1_start,
 												array_size_t block_1_end,
 												array_size_t block_2_start,
 												array_size_t block_2_end,
-												SortMetrics *metrics = nullptr);
+												Metrics *metrics = nullptr);
 
 	/*	Uses a binary search to identify spans of block_1 that can be
 	 * rotated into the midst of the block_2 */
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	array_size_t mergeTwoAdjacentBlocksBy_Rotation_BinarySearch(
 												T* array,
 												array_size_t block_1_start,
 												array_size_t block_1_end,
 												array_size_t block_2_start,
 												array_size_t block_2_end,
-												SortMetrics *metrics = nullptr);
+												Metrics *metrics = nullptr);
 
 	/*	The first merge is done using a binary search. Successive merges
 	 * are done searching right-to-left.  It is possible that right to
 	 * left is more efficient if block values are well interleaved */
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	array_size_t mergeTwoAdjacentBlocksBy_Rotation_Hybrid(
 												T* array,
 												array_size_t block_1_start,
 												array_size_t block_1_end,
 												array_size_t block_2_start,
 												array_size_t block_2_end,
-												SortMetrics *metrics = nullptr);
+												Metrics *metrics = nullptr);
 
 	/*	Starts with a_index & b_index at the end of their blocks, then
 	 * moves right_to_left to identify spans of block_2 that can be
 	 * rotated into the midst of the block_1 */
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	array_size_t mergeTwoAdjacentBlocksBy_Rotation_RightToLeft(
 												T* array,
 												array_size_t block_1_start,
 												array_size_t block_1_end,
 												array_size_t block_2_start,
 												array_size_t block_2_end,
-												SortMetrics *metrics = nullptr);
+												Metrics *metrics = nullptr);
 
 	/* 	Blocks do not have to be continuous nor do they have to be the same size */
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	array_size_t mergeTwoBlocksElementsUsingAuxiliaryBuffer(
 												T * array,
 											 	array_size_t block_1_start,
 												array_size_t block_1_end,
 												array_size_t block_2_start,
 												array_size_t block_2_end,
-												SortMetrics *metrics = nullptr);
+												Metrics *metrics = nullptr);
 
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	void swapBlockElementsOfEqualSize(T* array,
 									 array_size_t block1_start,
 									 array_size_t block_2_start,
 									 array_size_t block_size,
-									 SortMetrics *metrics = nullptr);
+									 Metrics *metrics = nullptr);
 
 	/*	**********************************************************************	*/
 	/*	**********************************************************************	*/
@@ -205,13 +205,13 @@ namespace BlockOperations
 	//	passed to them, such as mergeToAdjacentBlocksByRotation() or
 	//	mergeTwoBlocksElementsByTable()
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	array_size_t insertionSortPartial(T* 		   array,
 									  array_size_t begin,
 									  array_size_t ignored,
 									  array_size_t suspect,
 									  array_size_t end,
-									  SortMetrics *metrics)
+									  Metrics *metrics)
 	{
 		array_size_t highest_b_position = end;
 
@@ -267,12 +267,12 @@ namespace BlockOperations
 	 *	usage	blockSwap(array, 20, 30, 15);
 	 */
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	void swapBlockElementsOfEqualSize(T* array,
 									 array_size_t block1_start,
 									 array_size_t block2_start,
 									 array_size_t block_size,
-									 SortMetrics  *metrics)
+									 Metrics  *metrics)
 	{
 		if (block_size <= 0)
 			return;
@@ -39,38 +39,55 @@ namespace BlockOperations {
 
 	/*	This version treats the lower as being the smaller block	*/
 
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	array_size_t mergeTwoBlocksElementsUsingAuxiliaryBufferFor_LOWER (
 												T * array,
 												array_size_t block_1_start,
 												array_size_t block_1_end,
 												array_size_t block_2_start,
 												array_size_t block_2_end,
-												SortMetrics *metrics);
+												Metrics *metrics);
 
 	/*	This version treats the upper as being the smaller block	*/
 
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	array_size_t mergeTwoBlocksElementsUsingAuxiliaryBufferFor_UPPER (
 												T * array,
 												array_size_t block_1_start,
 												array_size_t block_1_end,
 												array_size_t block_2_start,
 												array_size_t block_2_end,
-												SortMetrics *metrics);
+												Metrics *metrics);
+
+	/*
+	 * 	Merging adjacent blocks through a fixed size cache that is supplied
+	 * 	by the caller.  The smaller block is copied into the cache and merged
+	 * 	back with the larger block, from the left if it is the lower block or
+	 * 	from the right if it is the upper block, so each element is moved
+	 * 	once.  The smaller block must fit in the cache.
+	 */
+
+	template <typename T, typename Metrics = SortMetrics>
+	array_size_t mergeTwoAdjacentBlocksUsingCache(	T * array,
+													array_size_t block_1_start,
+													array_size_t block_1_end,
+													array_size_t block_2_start,
+													array_size_t block_2_end,
+													T * cache,
+													Metrics *metrics = nullptr);
 
 	/*	******************************************************************	*/
 	/*			wrapper function that calls either LOWER or UPPER			*/
 	/*	******************************************************************	*/
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	array_size_t mergeTwoBlocksElementsUsingAuxiliaryBuffer(
 												T * array,
 												array_size_t block_1_start,
 												array_size_t block_1_end,
 												array_size_t block_2_start,
 												array_size_t block_2_end,
-												SortMetrics *metrics)
+												Metrics *metrics)
 	{
 		array_size_t block_1_size = block_1_end - block_1_start + 1;
 		array_size_t block_2_size = block_2_end - block_2_start + 1;
@@ -98,6 +115,84 @@ namespace BlockOperations {
 		}
 	}
 
+	template <typename T, typename Metrics>
+	array_size_t mergeTwoAdjacentBlocksUsingCache(	T * array,
+													array_size_t block_1_start,
+													array_size_t block_1_end,
+													array_size_t block_2_start,
+													array_size_t block_2_end,
+													T * cache,
+													Metrics *metrics)
+	{
+		array_size_t block_1_size = block_1_end - block_1_start + 1;
+		array_size_t block_2_size = block_2_end - block_2_start + 1;
+
+		if (block_1_size <= 0 || block_2_size <= 0) {
+			return block_2_end;
+		}
+
+		//	the blocks are already in order
+		if (metrics) metrics->compares++;
+		if (!(array[block_2_start] < array[block_1_end])) {
+			return block_2_end;
+		}
+
+		array_size_t b2_max_location = block_2_end;
+
+		if (block_1_size <= block_2_size) {
+			if (metrics) metrics->assignments += block_1_size;
+			for (array_size_t i = 0; i != block_1_size; i++) {
+				cache[i] = array[block_1_start + i];
+			}
+			array_size_t cached		= 0;
+			array_size_t b2_source	= block_2_start;
+			array_size_t dest		= block_1_start;
+			while (cached != block_1_size && b2_source <= block_2_end) {
+				if (metrics) metrics->compares++;
+				if (metrics) metrics->assignments++;
+				if (array[b2_source] < cache[cached]) {
+					if (b2_source == block_2_end)
+						b2_max_location = dest;
+					array[dest++] = array[b2_source++];
+				} else {
+					array[dest++] = cache[cached++];
+				}
+			}
+			//	any block_2 elements that are left are already in place
+			if (metrics) metrics->assignments += block_1_size - cached;
+			while (cached != block_1_size) {
+				array[dest++] = cache[cached++];
+			}
+		} else {
+			if (metrics) metrics->assignments += block_2_size;
+			for (array_size_t i = 0; i != block_2_size; i++) {
+				cache[i] = array[block_2_start + i];
+			}
+			array_size_t cached		= block_2_size - 1;
+			array_size_t b1_source	= block_1_end;
+			array_size_t dest		= block_2_end;
+			while (cached >= 0 && b1_source >= block_1_start) {
+				if (metrics) metrics->compares++;
+				if (metrics) metrics->assignments++;
+				if (cache[cached] < array[b1_source]) {
+					array[dest--] = array[b1_source--];
+				} else {
+					if (cached == block_2_size - 1)
+						b2_max_location = dest;
+					array[dest--] = cache[cached--];
+				}
+			}
+			//	any block_1 elements that are left are already in place
+			if (metrics) metrics->assignments += cached + 1;
+			while (cached >= 0) {
+				if (cached == block_2_size - 1)
+					b2_max_location = dest;
+				array[dest--] = cache[cached--];
+			}
+		}
+		return b2_max_location;
+	}
+
 	//	I did this instead of using std::queue<T> in order for the reader to
 	//	  clearly see the internals of how the auxiliary buffer (queue) works
 	template <typename T>
@@ -148,14 +243,14 @@ namespace BlockOperations {
 
 	/*	version that treats the lower as being the smaller block	*/
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	array_size_t mergeTwoBlocksElementsUsingAuxiliaryBufferFor_LOWER (
 												T * array,
 												array_size_t block_1_start,
 												array_size_t block_1_end,
 												array_size_t block_2_start,
 												array_size_t block_2_end,
-												SortMetrics *metrics)
+												Metrics *metrics)
 	{
 		auto add_one_compare = [&metrics] {
 			if (metrics)	metrics->compares++;
@@ -241,14 +336,14 @@ namespace BlockOperations {
 
 	/*	version that treats the upper as being the smaller block	*/
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	array_size_t mergeTwoBlocksElementsUsingAuxiliaryBufferFor_UPPER (
 												T * array,
 												array_size_t block_1_start,
 												array_size_t block_1_end,
 												array_size_t block_2_start,
 												array_size_t block_2_end,
-												SortMetrics *metrics)
+												Metrics *metrics)
 	{
 		auto add_one_compare = [&metrics] () {
 			if (metrics)	metrics->compares++;
@@ -56,6 +56,14 @@
  *		the whole array.  Successive searches for the boundaries are
  *		done step wise to the left which will be more efficient as long
  *		as the values are somewhat interleaved .
+ *
+ *	GALLOPING - the binary searches start at the unmerged end of the block
+ *		and probe exponentially (SortingUtilities::gallopingSearch), and
+ *		the right-to-left steps switch to galloping after
+ *		SortingUtilities::gallop_threshold steps in a row.  In blocks that
+ *		are barely interleaved, e.g. FEW_DISTINCT values, the spans are
+ *		long and each one costs about 2*lg(span) compares instead of the
+ *		span or lg(q).
  */
 
 namespace BlockOperations {
@@ -64,13 +72,43 @@ namespace BlockOperations {
 	/*	Forward declaration of special rotate function that does not require
 	 *	the blocks to be contiguous */
 
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	void rotateArrayElementsRight(T* array,
 								  array_size_t block_1_start,
 								  array_size_t block_1_end,
 								  array_size_t block_2_start,
 								  array_size_t block_2_end,
-								  SortMetrics *metrics);
+								  Metrics *metrics);
+
+	/*	Returns the index of the rightmost element of [start:i] that is
+	 * 	<= 'value', or start-1 if there is none, stepping left one compare
+	 * 	at a time, then galloping after gallop_threshold steps	*/
+	template <typename T, typename Metrics = SortMetrics>
+	array_size_t stepLeftPastGreater(T* array,
+									 array_size_t start,
+									 array_size_t i,
+									 T& value,
+									 Metrics *metrics);
+
+	template <typename T, typename Metrics>
+	array_size_t stepLeftPastGreater(T* array,
+									 array_size_t start,
+									 array_size_t i,
+									 T& value,
+									 Metrics *metrics) {
+
+		for (array_size_t steps = 0; i >= start; steps++, i--) {
+			if (steps == SortingUtilities::gallop_threshold) {
+				return SortingUtilities::gallopingSearch(array, start, i, value,
+														 true, true, metrics) - 1;
+			}
+			if (metrics) metrics->compares++;
+			if (array[i] <= value) {
+				break;
+			}
+		}
+		return i;
+	}
 
 	/*	******************************************************************************	*/
 	/*	******************************************************************************	*/
@@ -130,14 +168,14 @@ namespace BlockOperations {
 	 *		Bs = span_end + 1						= 14 + 1 = 15  out of bound
 	 */
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	array_size_t mergeTwoAdjacentBlocksBy_Rotation_BinarySearch(
 													T* 			 array,
 													array_size_t block_1_start,
 													array_size_t block_1_end,
 													array_size_t block_2_start,
 													array_size_t block_2_end,
-													SortMetrics *metrics) {
+													Metrics *metrics) {
 		//	debuggoing variables
 		constexpr bool debug_verbose= false;
 		bool announce_initial_array = true;
@@ -150,7 +188,7 @@ namespace BlockOperations {
 			return b_max_pos;
 		if (block_2_end - block_2_start < 0)
 			return b_max_pos;
-		if (block_1_end != block_2_end-1)
+		if (block_1_end != block_2_start-1)
 			return b_max_pos;
 
 		array_size_t a_unmerged_start	= block_1_start;
@@ -177,23 +215,24 @@ namespace BlockOperations {
 			array_size_t span_end;
 			array_size_t rotate_count;
 			first_a_greater_than_b =
-				SortingUtilities::binarySearchLastElement(array,
-														  a_unmerged_start, a_unmerged_end,
-														  array[b_unmerged_start],
-														  metrics);
+				SortingUtilities::gallopingSearch(array,
+												  a_unmerged_start, a_unmerged_end,
+												  array[b_unmerged_start],
+												  false, true, metrics);
 			// If all of a is less than of equal to b_start, we are done
 			if (first_a_greater_than_b == b_unmerged_start) {
 				break;
 			}
 			span_start = first_a_greater_than_b;
 			first_b_greater_than_a =
-				SortingUtilities::binarySearchLastElement(array,
-														  b_unmerged_start, b_unmerged_end,
-														  array[span_start],
-														  metrics);
+				SortingUtilities::gallopingSearch(array,
+												  b_unmerged_start, b_unmerged_end,
+												  array[span_start],
+												  false, false, metrics);
 			//	the span of A values that can be rotated right ends at the
-			//	element immediately before the first B value that is
-			//	greater than the a_value at the start of the span
+			//	element immediately before the first B value that is not
+			//	less than the a_value at the start of the span, so that B
+			//	values equal to it stay to its right
 			//	0 1 2 3 4   5 6 7 8 9
 			//	A B G H I | D E F J K	a[G] >_b_st[D] = 2  b[J] > a[G] = 8
 			//							span [2:7] [G:F], rotate 8-5 = 3
@@ -300,14 +339,14 @@ namespace BlockOperations {
 	 * 	There are no elements in b that are less than [a_e]
 	 */
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	array_size_t mergeTwoAdjacentBlocksBy_Rotation_RightToLeft(
 												T* 			 array,
 												array_size_t block_1_start,
 												array_size_t block_1_end,
 												array_size_t block_2_start,
 												array_size_t block_2_end,
-												SortMetrics *metrics)
+												Metrics *metrics)
 	{
 		constexpr bool debug_verbose		= false;
 		std::stringstream initial_array_msg;
@@ -339,6 +378,9 @@ namespace BlockOperations {
 		//	set to false after the first time b_unmerged_end moves
 		bool b_max_frozen				= false;
 
+		//	times in a row that [b_end] was already in place
+		array_size_t b_end_steps		= 0;
+
 		//	keep going until all of a is to the right of b
 		//	or there is no more b to be merged
 		while (b_unmerged_end 	 > a_unmerged_end &&
@@ -369,15 +411,22 @@ namespace BlockOperations {
 					b_max_frozen = true;
 				}
 				b_unmerged_end--;
+				//	b keeps staying put, gallop to the first b that moves
+				if (++b_end_steps == SortingUtilities::gallop_threshold) {
+					b_end_steps 	= 0;
+					b_unmerged_end	= SortingUtilities::gallopingSearch(
+											array,
+											b_unmerged_start, b_unmerged_end,
+											array[a_unmerged_end],
+											true, false, metrics) - 1;
+				}
 				continue;
 			}
+			b_end_steps = 0;
 			// array[b_end] is less than a[end] - determine how many
 			//	other a elements are greater than b
-			if (metrics) metrics->compares++;
-			while (a_i >= a_unmerged_start && array[a_i] > array[b_unmerged_end]) {
-				a_i--;
-				if (metrics) metrics->compares++;
-			}
+			a_i = stepLeftPastGreater(array, a_unmerged_start, a_i,
+									  array[b_unmerged_end], metrics);
 
 			//	2.  all elements in a are greater than [b_end]
 			//			rotate [start:b_end] by (b_end-a_end)
@@ -405,11 +454,8 @@ namespace BlockOperations {
 			//
 			// 	find the first value in b that is less than array[a_i]
 			//	(a_i is the element immediately to the left of the span)
-			if (metrics) metrics->compares++;
-			while (array[b_i] > array[a_i] && b_i > a_unmerged_end) {
-				b_i--;
-				if (metrics) metrics->compares++;
-			}
+			b_i = stepLeftPastGreater(array, a_unmerged_end+1, b_i,
+									  array[a_i], metrics);
 			span_start 	= a_i + 1;
 			span_end	= b_unmerged_end;
 			//	how much do you need to rotate to get a_end
@@ -496,14 +542,14 @@ namespace BlockOperations {
 	 * and thus the gaps do not require a lot of searching.
 	 */
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	array_size_t mergeTwoAdjacentBlocksBy_Rotation_Hybrid(
 												T* 			 array,
 												array_size_t block_1_start,
 												array_size_t block_1_end,
 												array_size_t block_2_start,
 												array_size_t block_2_end,
-												SortMetrics *metrics) {
+												Metrics *metrics) {
 		constexpr bool debug_verbose = false;
 		std::stringstream initial_array_msg;
 
@@ -620,6 +666,9 @@ namespace BlockOperations {
 													   metrics);
 		}
 
+		//	times in a row that [b_end] was already in place
+		array_size_t b_end_steps		= 0;
+
 		//	Binary search has been used to position a_end and b_end possibly
 		// close to the next span of [b_i:b_end] within [a_start:a_end]
 		while (b_unmerged_end 	 > a_unmerged_end &&
@@ -646,15 +695,22 @@ namespace BlockOperations {
 					b_max_locked = true;
 				}
 				b_unmerged_end--;
+				//	b keeps staying put, gallop to the first b that moves
+				if (++b_end_steps == SortingUtilities::gallop_threshold) {
+					b_end_steps 	= 0;
+					b_unmerged_end	= SortingUtilities::gallopingSearch(
+											array,
+											b_unmerged_start, b_unmerged_end,
+											array[a_unmerged_end],
+											true, false, metrics) - 1;
+				}
 				continue;
 			}
+			b_end_steps = 0;
 			// array[b_end] is less than a[end] - determine how many
 			//	other a elements are greater than b
-			if (metrics) metrics->compares++;
-			while (a_i >= a_unmerged_start && array[a_i] > array[b_unmerged_end]) {
-				a_i--;
-				if (metrics) metrics->compares++;
-			}
+			a_i = stepLeftPastGreater(array, a_unmerged_start, a_i,
+									  array[b_unmerged_end], metrics);
 
 			//	2.  all elements in a are greater than [b_end]
 			//			rotate [start:b_end] by (b_end-a_end)
@@ -682,11 +738,8 @@ namespace BlockOperations {
 			//
 			// 	find the first value in b that is less than array[a_i]
 			//	(a_i is the element immediately to the left of the span)
-			if (metrics) metrics->compares++;
-			while (array[b_i] > array[a_i] && b_i > a_unmerged_end) {
-				b_i--;
-				if (metrics) metrics->compares++;
-			}
+			b_i = stepLeftPastGreater(array, a_unmerged_end+1, b_i,
+									  array[a_i], metrics);
 			span_start 	= a_i + 1;
 			span_end	= b_unmerged_end;
 			//	how much do you need to rotate to get a_end
@@ -762,12 +815,12 @@ namespace BlockOperations {
 	/*	******************************************************************************	*/
 	/*	******************************************************************************	*/
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	void rotateArrayElementsRight(T* array,
 								  array_size_t span_start,
 								  array_size_t span_end,
 								  array_size_t amount,
-								  SortMetrics *metrics) {
+								  Metrics *metrics) {
 
 		//	qualify all of the block indices
 		if (span_end == span_start) {
@@ -788,20 +841,8 @@ namespace BlockOperations {
 		if (amount == 0)
 			return;
 
-		//	reverse the entire array
-		for (array_size_t i = span_start, j = span_end; i < j; j++, j--) {
-			SortingUtilities::swap(array, i, j, metrics);
-		}
-
-		//	reverse the left hand side
-		for (array_size_t i = span_start, j = span_start+amount-1; i < j; i++, j--) {
-			SortingUtilities::swap(array, i, j, metrics);
-		}
-
-		//	reverse the right hand side
-		for (array_size_t i = span_start + amount, j = span_end; i < j; i++, j--) {
-			SortingUtilities::swap(array, i, j, metrics);
-		}
+		//	the last 'amount' elements move to the front
+		Rotation::rotate(array, span_start, span_size-amount, amount, metrics);
 	}
 
 }	// namespace BlockOperations
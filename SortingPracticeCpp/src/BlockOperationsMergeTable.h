@@ -31,30 +31,30 @@ namespace BlockOperations {
 	/*	******************************************************************************	*/
 	/*	******************************************************************************	*/
 
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	array_size_t mergeTwoBlocksElementsByTableLowerSmallest(T * array,
 											 array_size_t block_1_start,
 											 array_size_t block_1_end,
 											 array_size_t block_2_start,
 											 array_size_t block_2_end,
-											 SortMetrics *metrics);
-	template <typename T>
+											 Metrics *metrics);
+	template <typename T, typename Metrics = SortMetrics>
 	array_size_t mergeTwoBlocksElementsByTableUpperSmallest(T * array,
 											 array_size_t block_1_start,
 											 array_size_t block_1_end,
 											 array_size_t block_2_start,
 											 array_size_t block_2_end,
-											 SortMetrics *metrics);
+											 Metrics *metrics);
 
 	/*
-	 *	template <typename T>
+	 *	template <typename T, typename Metrics = SortMetrics>
 	 * 	array_size_t mergeTwoBlocksElementsByTable(
 	 * 										T * array,
 	 *										array_size_t block_1_start,
 	 *	 									array_size_t block_1_end,
 	 *										array_size_t block_2_start,
 	 *										array_size_t block_2_end,
-	 *										SortMetrics *metrics) {
+	 *										Metrics *metrics) {
 	 *
 	 *	Two blocks, which do not have to be contiguous, are merged in place
 	 *	by maintaining a table of to where a block elements get displaced
@@ -81,6 +81,13 @@ namespace BlockOperations {
 	 * 	  there is a function perform the merge for when block_1 is smaller than
 	 * 	  or equal to block_2's size, and a separate function for when block_2 is
 	 * 	  the smaller block
+	 *
+	 * 	The larger block's unmerged elements stay where they started, in order,
+	 * 	  so after it wins SortingUtilities::gallop_threshold compares in a row,
+	 * 	  a galloping search finds how many more of its elements go before the
+	 * 	  smaller block's next element, and those are moved without comparing.
+	 * 	  The smaller block's elements are scattered by the table & can't be
+	 * 	  searched.
 	 */
 
 	/*
@@ -89,13 +96,13 @@ namespace BlockOperations {
 	 * 		mergeTwoBlocksElemetnsByTableUpperSmaller
 	 */
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	array_size_t mergeTwoBlocksElementsByTable(T * array,
 											 array_size_t block_1_start,
 											 array_size_t block_1_end,
 											 array_size_t block_2_start,
 											 array_size_t block_2_end,
-											 SortMetrics *metrics) {
+											 Metrics *metrics) {
 
 		array_size_t block_1_size = block_1_end - block_1_start + 1;
 		array_size_t block_2_size = block_2_end - block_2_start + 1;
@@ -135,13 +142,13 @@ namespace BlockOperations {
 	 * 	final location of that element is stored to return to caller
 	 */
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	array_size_t mergeTwoBlocksElementsByTableLowerSmallest(T * array,
 											 array_size_t block_1_start,
 											 array_size_t block_1_end,
 											 array_size_t block_2_start,
 											 array_size_t block_2_end,
-											 SortMetrics *metrics)
+											 Metrics *metrics)
 	{
 		array_size_t largest_b2_position 	= block_2_end;
 
@@ -169,6 +176,13 @@ namespace BlockOperations {
 		array_size_t block_2_source	= block_2_start;
 		array_size_t dest  			= block_1_start;
 
+		//	block_2 elements taken in a row, and the number of block_2 elements
+		//	  that a gallop found go before the next block_1 element, which
+		//	  goes next without a compare once the run has been moved
+		array_size_t block_2_wins	= 0;
+		array_size_t block_2_run	= 0;
+		bool block_1_is_next		= false;
+
 		//	This loop will terminate when either:
 		//	   the table of block_1 elements is empty (all block_1 values merged)
 		//	OR all of block_2's elements have been merged
@@ -180,9 +194,19 @@ namespace BlockOperations {
 			// Point to the current location of the next block_1 element which may
 			//	have been displaced in a previous pass through this loop.
 			array_size_t block_1_source = block_1_locations_table[table_index];
-			if (metrics) metrics->compares++;
+			bool block_1_goes_first		= false;
+			if (block_2_run != 0) {
+				block_2_run--;
+			} else if (block_1_is_next) {
+				block_1_goes_first	= true;
+				block_1_is_next		= false;
+			} else {
+				if (metrics) metrics->compares++;
+				block_1_goes_first = array[block_1_source] <= array[block_2_source];
+			}
 
-			if (array[block_1_source] <= array[block_2_source]) {
+			if (block_1_goes_first) {
+				block_2_wins = 0;
 				// the value from block 1 goes into 'dest'
 				if (dest != block_1_source) {
 					SortingUtilities::swap( array,
@@ -229,6 +253,16 @@ namespace BlockOperations {
 				//	if all the elements from block_2 are in place, break loop
 				if (++block_2_source > block_2_end)
 					break;
+				//	block 2 keeps winning, search for the end of its run
+				if (block_2_run == 0 &&
+					++block_2_wins == SortingUtilities::gallop_threshold) {
+					block_2_wins = 0;
+					block_2_run	 = SortingUtilities::gallopingSearch(
+										array, block_2_source, block_2_end,
+										array[block_1_locations_table[table_index]],
+										false, false, metrics) - block_2_source;
+					block_1_is_next = true;
+				}
 			}
 		}
 
@@ -293,13 +327,13 @@ namespace BlockOperations {
 	 *	table need to be restored to their correct order by flushing the table
 	 */
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	array_size_t mergeTwoBlocksElementsByTableUpperSmallest(T * array,
 											 array_size_t block_1_start,
 											 array_size_t block_1_end,
 											 array_size_t block_2_start,
 											 array_size_t block_2_end,
-											 SortMetrics *metrics)
+											 Metrics *metrics)
 	{
 		array_size_t b2_max_position 		= block_2_end;
 
@@ -321,6 +355,13 @@ namespace BlockOperations {
 		array_size_t b1_source 		= block_1_end;
 		array_size_t dest			= block_2_end;
 
+		//	block_1 elements taken in a row, and the number of block_1 elements
+		//	  that a gallop found go after the next block_2 element, which
+		//	  goes next without a compare once the run has been moved
+		array_size_t b1_wins		= 0;
+		array_size_t b1_run			= 0;
+		bool b2_is_next				= false;
+
 		//	This loop exits (break) when either
 		//	  	all of the block_2 elements are in place (table_index = -1)
 		//	OR  there are no more block 1 elements to be placed (b1_source < block_1_start
@@ -331,9 +372,18 @@ namespace BlockOperations {
 		{
 			// determine position of the current block 2 element to be merged
 			array_size_t b2_source = block_2_locations_table[table_index];
-			if (metrics) metrics->compares++;
+			bool b1_goes_last	   = true;
+			if (b1_run != 0) {
+				b1_run--;
+			} else if (b2_is_next) {
+				b1_goes_last = false;
+				b2_is_next	 = false;
+			} else {
+				if (metrics) metrics->compares++;
+				b1_goes_last = array[b1_source] > array[b2_source];
+			}
 
-			if (array[b1_source] > array[b2_source]) {
+			if (b1_goes_last) {
 				// b1 is the larger element
 				if (b1_source != dest) {
 					SortingUtilities::swap(array, dest, b1_source, metrics);
@@ -361,7 +411,18 @@ namespace BlockOperations {
 				if (--b1_source < block_1_start) {
 					break;
 				}
+				//	block 1 keeps winning, search for the start of its run
+				if (b1_run == 0 &&
+					++b1_wins == SortingUtilities::gallop_threshold) {
+					b1_wins = 0;
+					b1_run	= b1_source + 1 - SortingUtilities::gallopingSearch(
+										array, block_1_start, b1_source,
+										array[block_2_locations_table[table_index]],
+										true, true, metrics);
+					b2_is_next = true;
+				}
 			} else {
+				b1_wins = 0;
 				// block_2's element is the larger element
 				if (b2_source != dest) {
 					SortingUtilities::swap(array, dest, b2_source, metrics);
@@ -23,8 +23,10 @@
 #include "IntegerArithmetic.h"
 #include "SortingUtilities.h"
 #include "SortingDebugOutput.h"
-#include "InsertionSort.h"
+#include "ScratchBuffer.h"
+#include "SimdSortingNetwork.h"
 #include "BlockOperations.h"
+#include "BlockSortInternalBuffer.h"
 
 #pragma push_macro("_dbg_ln")
 #pragma push_macro("_dbg")
@@ -41,19 +43,19 @@ namespace BlockSort {
 
 	/*	These make reading the actual sort source code a little cleaner	*/
 
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	void assignBlockMergeFunction(
-			BlockOperations::MergeFunction<T>& function,
+			BlockOperations::MergeFunction<T, Metrics>& function,
 			BlockOperations::MergeStrategy strategy);
 
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	void assignCreateDescriptorsFunction(
-			BlockSort::CreateDescriptorsFunction<T> &function,
+			BlockSort::CreateDescriptorsFunction<T, Metrics> &function,
 			BlockSort::BlockOrganizations organization);
 
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	void assignSortBlocksFunction(
-			BlockSort::SortBlocksFunction<T>& function,
+			BlockSort::SortBlocksFunction<T, Metrics>& function,
 			BlockSort::BlockSortingStrategy strategy);
 
  	/*	**************************************************************************	*/
@@ -66,27 +68,27 @@ namespace BlockSort {
 	 * as the A_Blocks, and the elements form [mid:end] as the B_Blocks.
 	 * The blocks are then sorted.  The blocks are then merged
 	 */
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	void sort(	T* array,
 				array_size_t start, array_size_t mid, array_size_t end,
-				SortMetrics *metrics = nullptr);
+				Metrics *metrics = nullptr);
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	void sort(	T* array,
 				array_size_t start, array_size_t mid, array_size_t end,
-				SortMetrics *metrics)
+				Metrics *metrics)
 	{
-		BlockSort::CreateDescriptorsFunction<T> createDescriptors;
-		assignCreateDescriptorsFunction<T>( createDescriptors,
-											BlockSort::BlockOrganizations::SYMMETRIC);
+		BlockSort::CreateDescriptorsFunction<T, Metrics> createDescriptors;
+		assignCreateDescriptorsFunction<T, Metrics>( createDescriptors,
+													 BlockSort::BlockOrganizations::SYMMETRIC);
 
-		BlockSort::SortBlocksFunction<T> sortBlocks;
-		assignSortBlocksFunction<T>(sortBlocks,
-									BlockSort::BlockSortingStrategy::TABLE);
+		BlockSort::SortBlocksFunction<T, Metrics> sortBlocks;
+		assignSortBlocksFunction<T, Metrics>(sortBlocks,
+											 BlockSort::BlockSortingStrategy::TABLE);
 
-		BlockOperations::MergeFunction<T> 	mergeBlocks;
-		assignBlockMergeFunction<T>(mergeBlocks,
-									BlockOperations::MergeStrategy::TABLE);
+		BlockOperations::MergeFunction<T, Metrics> 	mergeBlocks;
+		assignBlockMergeFunction<T, Metrics>(mergeBlocks,
+											 BlockOperations::MergeStrategy::TABLE);
 
 		//	The size of the blocks is defined as the sqrt of the size of
 		//	the lower half of the array, which is always <= the size of
@@ -117,19 +119,49 @@ namespace BlockSort {
 
 	constexpr array_size_t initial_block_size = 16;
 
-	template <typename T>
-	void sort(T *array, array_size_t size, SortMetrics *metrics = nullptr);
+	template <typename T, typename Metrics = SortMetrics>
+	void sort(T *array, array_size_t size, Metrics *metrics = nullptr);
 
-	template <typename T>
-	void sort(T *array, array_size_t size, SortMetrics *metrics) {
+	/*	  The same sort with a cache owned by the caller, whose capacity is
+	 * chosen by the caller.  Merges whose smaller half fits in the cache
+	 * copy that half into it and merge it back in a single pass.  Larger
+	 * merges are block merged as above.	*/
+	template <typename T, typename Metrics = SortMetrics>
+	void sort(T *array, array_size_t size, ScratchBuffer<T> &cache,
+			  Metrics *metrics = nullptr);
+
+	template <typename T, typename Metrics = SortMetrics>
+	void sortUsingCache(T *array, array_size_t size,
+						T *cache, array_size_t cache_size,
+						Metrics *metrics = nullptr);
+
+	template <typename T, typename Metrics>
+	void sort(T *array, array_size_t size, Metrics *metrics) {
+
+		sortUsingCache(array, size, static_cast<T*>(nullptr), 0, metrics);
+	}
+
+	template <typename T, typename Metrics>
+	void sort(T *array, array_size_t size, ScratchBuffer<T> &cache,
+			  Metrics *metrics) {
+
+		ScratchLease<T> lease(cache.capacity(), &cache);
+		sortUsingCache(array, size, lease.get(), cache.capacity(), metrics);
+	}
+
+	template <typename T, typename Metrics>
+	void sortUsingCache(T *array, array_size_t size,
+						T *cache, array_size_t cache_size,
+						Metrics *metrics) {
 
 		constexpr bool debug_verbose = false;
 
 		if (size < 2*initial_block_size) {
-			InsertionSort::sort(array, size, metrics);
+			SimdSortingNetwork::sort(array, size, metrics);
 		}
 
 		//	Initially sort the elements within each block using an insertion sort
+		//	  or a sorting network for primitive types
 		for (array_size_t block_start = 0;
 						  block_start < size;
 						  block_start += initial_block_size)
@@ -138,7 +170,7 @@ namespace BlockSort {
 			if (block_start + initial_block_size > size) {
 				sub_array_size = size - block_start;
 			}
-			InsertionSort::sort(&array[block_start], sub_array_size, metrics);
+			SimdSortingNetwork::sort(&array[block_start], sub_array_size, metrics);
 		}
 		_dbg_ln("  Made it through sorting initial blocks");
 
@@ -154,7 +186,14 @@ namespace BlockSort {
 			if (block_2_end > size-1)
 				block_2_end = size-1;
 			while (block_2_start < size) {
-				sort(array, block_1_start, block_2_start, block_2_end, metrics);
+				if (block_2_end - block_2_start + 1 <= cache_size) {
+					BlockOperations::mergeTwoAdjacentBlocksUsingCache(array,
+							block_1_start, block_2_start-1,
+							block_2_start, block_2_end,
+							cache, metrics);
+				} else {
+					sort(array, block_1_start, block_2_start, block_2_end, metrics);
+				}
 				block_1_start = block_2_end+1;
 				block_1_end	  = block_1_start + block_size - 1;
 				//	if block 1 extends to or past the end of the array
@@ -177,73 +216,73 @@ namespace BlockSort {
 	/*					Functions to make main function more concise		*/
 	/*	******************************************************************	*/
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	void assignCreateDescriptorsFunction(
-			BlockSort::CreateDescriptorsFunction<T> &function,
+			BlockSort::CreateDescriptorsFunction<T, Metrics> &function,
 			BlockSort::BlockOrganizations organization)
 	{
 		switch (organization) {
 			case BlockSort::BlockOrganizations::FULL_A0_BLOCK:
-				function = createBlockDescriptors_A0_Full<T>;
+				function = createBlockDescriptors_A0_Full<T, Metrics>;
 				break;
 			case BlockSort::BlockOrganizations::SYMMETRIC:
-				function = createBlockDescriptorsSymmetrically<T>;
+				function = createBlockDescriptorsSymmetrically<T, Metrics>;
 				break;
 			}
 	}
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	void assignSortBlocksFunction(
-			BlockSort::SortBlocksFunction<T>& function,
+			BlockSort::SortBlocksFunction<T, Metrics>& function,
 			BlockSort::BlockSortingStrategy strategy)
 	{
 		switch(strategy) {
 		case BlockSort::BlockSortingStrategy::BINARY:
-			function = sortBlocksBinarySearch<T>;
+			function = sortBlocksBinarySearch<T, Metrics>;
 			break;
 		case BlockSort::BlockSortingStrategy::HYBRID:
-			function = sortBlocksHybrid<T>;
+			function = sortBlocksHybrid<T, Metrics>;
 			break;
 		case BlockSort::BlockSortingStrategy::RIGHT_TO_LEFT:
-			function = sortBlocksRightToLeft<T>;
+			function = sortBlocksRightToLeft<T, Metrics>;
 			break;
 		default:
 		case BlockSort::BlockSortingStrategy::TABLE:
-			function = sortBlocksByTable<T>;
+			function = sortBlocksByTable<T, Metrics>;
 			break;
 		}
 	}
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	void assignBlockMergeFunction(
-				BlockOperations::MergeFunction<T>& function,
+				BlockOperations::MergeFunction<T, Metrics>& function,
 				BlockOperations::MergeStrategy strategy)
 	{
 		switch(strategy) {
 		case BlockOperations::MergeStrategy::AUXILLIARY:
 			function =
-				BlockOperations::mergeTwoBlocksElementsUsingAuxiliaryBuffer<T>;
+				BlockOperations::mergeTwoBlocksElementsUsingAuxiliaryBuffer<T, Metrics>;
 			break;
 		case BlockOperations::MergeStrategy::BINARY:
 			function =
-				BlockOperations::mergeTwoAdjacentBlocksBy_Rotation_BinarySearch<T>;
+				BlockOperations::mergeTwoAdjacentBlocksBy_Rotation_BinarySearch<T, Metrics>;
 			break;
 		case BlockOperations::MergeStrategy::HYBRID:
 			function =
-				BlockOperations::mergeTwoAdjacentBlocksBy_Rotation_Hybrid<T>;
+				BlockOperations::mergeTwoAdjacentBlocksBy_Rotation_Hybrid<T, Metrics>;
 			break;
 		case BlockOperations::MergeStrategy::INSERTION:
 			function =
-				BlockOperations::insertionSortPartial<T>;
+				BlockOperations::insertionSortPartial<T, Metrics>;
 			break;
 		case BlockOperations::MergeStrategy::RGT_TO_LFT:
 			function =
-				BlockOperations::mergeTwoAdjacentBlocksBy_Rotation_RightToLeft<T>;
+				BlockOperations::mergeTwoAdjacentBlocksBy_Rotation_RightToLeft<T, Metrics>;
 			break;
 		case BlockOperations::MergeStrategy::TABLE:
 		default:
 			function =
-				BlockOperations::mergeTwoBlocksElementsByTable<T>;
+				BlockOperations::mergeTwoBlocksElementsByTable<T, Metrics>;
 			break;
 		}
 	}
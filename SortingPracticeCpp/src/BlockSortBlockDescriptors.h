@@ -18,24 +18,24 @@ namespace BlockSort {
 	template <typename T>
 	class BlockDescriptor;
 
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	using CreateDescriptorsFunction = int (*)( T* array,
 										   	   array_size_t start,
 											   array_size_t mid,
 											   array_size_t end,
 											   array_size_t block_size,
 											   Descriptors<T> &blocks,
-											   SortMetrics *metrics);
+											   Metrics *metrics);
 
 
 	/*	Assigns key values to the blocks.  This is useful if the underlying array
 	 * has been sorted, such as initially sorting element within blocks. */
 
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	SortMetrics assignBlockKeys(T* array,
 								std::unique_ptr<BlockDescriptor<T>[]> &descriptors,
 								int num_descriptors,
-								SortMetrics *metrics = nullptr);
+								Metrics *metrics = nullptr);
 
 	/*	Creates an array of block descriptors of types A & B {A[0]A[1]..A[m]B[0]..B[n]}
 	 * 	  where A[0] is a full block but B[n] may not be a full block in the case where
@@ -44,14 +44,14 @@ namespace BlockSort {
 	 * 	It is the caller's responsibility to ensure that mid is an integer multiple
 	 * 	  of block_size from start. 	*/
 
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	int createBlockDescriptors_A0_Full( 	T* array,
 											array_size_t start,
 											array_size_t mid,
 											array_size_t end,
 											array_size_t block_size,
 											Descriptors<T> &descriptors,
-											SortMetrics *metrics = nullptr);
+											Metrics *metrics = nullptr);
 
 
 	/*	Creates an array of block descriptors of types A & B {[A0][A1]..[Am][B0]..[Bn]}
@@ -60,25 +60,25 @@ namespace BlockSort {
 	 * 		and the last B_Block will have 1 element.
 	 * 	There is no restriction on the value of mid from start	*/
 
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	int createBlockDescriptorsSymmetrically(T* array,
 											array_size_t start,
 											array_size_t mid,
 											array_size_t end,
 		    								array_size_t block_size,
 											Descriptors<T> &descriptors,
-											SortMetrics *metrics = nullptr);
+											Metrics *metrics = nullptr);
 
 	/*
 	 * 	Makes createBlock_______() more concise
 	 */
 
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	void assignBlockData(BlockDescriptor<T> &block,
 						 T*array, BlockType type,
 						 array_size_t start,
 						 array_size_t block_size,
-						 SortMetrics *metrics = nullptr);
+						 Metrics *metrics = nullptr);
 
 
 	/*	***********************************************************************************	*/
@@ -93,11 +93,11 @@ namespace BlockSort {
 	 *	  rather than using one of the blockDescriptor sorting functions
 	 */
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	void assignBlockKeys(T**array,
 						 std::unique_ptr<BlockDescriptor<T>[]> &descriptors,
 						 int num_descriptors,
-						 SortMetrics *metrics) {
+						 Metrics *metrics) {
 
 		for (int i = 0; i != num_descriptors; i++) {
 			BlockDescriptor<T>*p = &descriptors[i];	// improves readability
@@ -164,14 +164,14 @@ namespace BlockSort {
 	 * 	Returns the count of tags which is 4
 	 */
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	int createBlockDescriptors_A0_Full( T* 			 array,
 										array_size_t start,
 										array_size_t mid,
 										array_size_t end,
 										array_size_t block_size,
 										Descriptors<T> &blocks,
-										SortMetrics *metrics) {
+										Metrics *metrics) {
 
 		array_size_t lower_span = mid-start;
 		array_size_t upper_span = end-mid + 1;
@@ -265,14 +265,14 @@ namespace BlockSort {
 	 * 	returns the count of tags which is 4
 	 */
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	int  createBlockDescriptorsSymmetrically(	T* 			 array,
 												array_size_t start,
 												array_size_t mid,
 												array_size_t end,
 												array_size_t block_size,
 												Descriptors<T> &blocks,
-												SortMetrics *metrics) {
+												Metrics *metrics) {
 
 		array_size_t lower_span = mid-start;
 		array_size_t upper_span = end-mid + 1;
@@ -347,10 +347,10 @@ namespace BlockSort {
 	 * 	Helper routine to make createBlock functions more concise
 	 */
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	void assignBlockData(BlockDescriptor<T> &block, T* array, BlockType type,
 						 array_size_t start, array_size_t block_size,
-						 SortMetrics *metrics) {
+						 Metrics *metrics) {
 		block.type 			= type;
 		block.start_index 	= start;
 		block.end_index		= start + block_size-1;
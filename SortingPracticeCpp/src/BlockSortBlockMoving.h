@@ -25,77 +25,77 @@ namespace BlockSort {
 	 * B_Block in question.  B blocks should go the right of all A_Blocks with
 	 * equal or lesser keys.
 	 */
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	void binarySearchLastBlock(Descriptors<T> &descriptors,
 							   array_size_t range_left,
 							   array_size_t range_right,
 						   	   T &key,
 							   array_size_t &key_location,
-							   SortMetrics *metrics = nullptr);
+							   Metrics *metrics = nullptr);
 
 	/*
 	 *  Rotates the block descriptors, and the underlying array, to the right
 	 */
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	void rotateBlocksRight(T* array,
 						   Descriptors<T> &descriptors,
 						   array_size_t first,
 						   array_size_t last,
 						   array_size_t block_rotate_count,
-						   SortMetrics *metrics = nullptr);
+						   Metrics *metrics = nullptr);
 
 	/*
 	 * 	This rotates Descriptor positions within the list of Descriptors
 	 * 	but does not rotate the underlying array.  rotate_count < 0 is rotate_left
 	 */
 
-	template<typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	void rotate_ONLY_BlockDescriptorsRight(	Descriptors<T> &descriptors,
 											array_size_t list_start,
 											array_size_t list_end,
 											array_size_t rotate_count,
-											SortMetrics *metrics = nullptr);
+											Metrics *metrics = nullptr);
 
 	/*	Swaps two blocks and the underlying array regardless of the relative size
 	 * of each block.  Calls the appropriate EqualSize, LeftSmallerThanRight or
 	 * RightSmallerThanLeft
 	 */
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	void swapBlocks(T* array,
 					Descriptors<T> &descriptors,
 					array_size_t i,
 					array_size_t j,
-					SortMetrics *metrics = nullptr);
+					Metrics *metrics = nullptr);
 
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	void swapBlocksLeftSmallerThanRight(T* array,
 										Descriptors<T> &descriptors,
 										array_size_t u,
 										array_size_t v,
-										SortMetrics *metrics = nullptr);
+										Metrics *metrics = nullptr);
 
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	void swapBlocksOfEqualSize(			T* array,
 										Descriptors<T> &descriptors,
 										array_size_t u,
 										array_size_t v,
-										SortMetrics *metrics = nullptr);
+										Metrics *metrics = nullptr);
 
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	void swapBlocksRightSmallerThanLeft(T* array,
 										Descriptors<T> &descriptors,
 										array_size_t u,
 										array_size_t v,
-										SortMetrics *metrics = nullptr);
+										Metrics *metrics = nullptr);
 
 	/*
 	 * 	This swaps block descriptors, but DOES NOT move the underlying array
 	 */
-	template<typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	void swap_ONLY_BlockDescriptors(Descriptors<T> &descriptors,
 									array_size_t i,
 									array_size_t j,
-									SortMetrics *metrics = nullptr);
+									Metrics *metrics = nullptr);
 
 	/*	**********************************************************************	*/
 	/*	**********************************************************************	*/
@@ -115,13 +115,13 @@ namespace BlockSort {
 	 */
 
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	void binarySearchLastBlock(Descriptors<T> &blocks,
 							   array_size_t range_left,
 							   array_size_t range_right,
 						   	   T &key,
 							   array_size_t &key_location,
-							   SortMetrics *metrics)
+							   Metrics *metrics)
 	{
 		//	debugging resources
 		constexpr bool 		debug_verbose = false;
@@ -195,13 +195,13 @@ namespace BlockSort {
 	}
 
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	void rotateBlocksRight(	T* array,
 							Descriptors<T> &descriptors,
 					        array_size_t first,
 							array_size_t last,
 							array_size_t block_rotate_count,
-							SortMetrics *metrics)
+							Metrics *metrics)
 	{
 		/*	**************************************	*/
 		/*				Debugging					*/
@@ -304,12 +304,12 @@ namespace BlockSort {
 	 * 	rotates a list of descriptors to the right by rotate_count.
 	 * 	If rotate_count is negative, the rotation is to the left
 	 */
-	template<typename T>
+	template <typename T, typename Metrics>
 	void rotate_ONLY_BlockDescriptorsRight(	Descriptors<T> &descriptors,
 											array_size_t start,
 											array_size_t end,
 											array_size_t rotate_count,
-											SortMetrics *metrics)
+											Metrics *metrics)
 	{
 		auto debug = [&] () {
 			if(false) {
@@ -358,12 +358,12 @@ namespace BlockSort {
 	 * 	swapBlocksRightSmallerThanLeft()
 	 */
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	void swapBlocks(T* array,
 					Descriptors<T> &descriptors,
 					array_size_t u,
 					array_size_t v,
-					SortMetrics *metrics) {
+					Metrics *metrics) {
 
 		if (u == v) {
 			return;
@@ -421,12 +421,12 @@ namespace BlockSort {
 	 *		update the .start & .end indices of the tags on [first:last]
 	 */
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	void swapBlocksLeftSmallerThanRight(T* array,
 										Descriptors<T> &descriptors,
 										array_size_t u,
 										array_size_t v,
-										SortMetrics *metrics) {
+										Metrics *metrics) {
 
 		/*
 		 * 	left_size = lz = 1					right_size = rz = 4
@@ -512,11 +512,11 @@ namespace BlockSort {
 	 *  Blocks that are of different sizes must be swapped with a rotate, which
 	 *  adds considerable more time complexity.
 	 */
-	template <typename T>
+	template <typename T, typename Metrics>
 	void swapBlocksOfEqualSize(	T* array,
 								Descriptors<T> &descriptors,
 								array_size_t u, array_size_t v,
-								SortMetrics *metrics) {
+								Metrics *metrics) {
 
 //		std::cout << __FUNCTION__ << std::endl;
 		BlockOperations::swapBlockElementsOfEqualSize(
@@ -535,12 +535,12 @@ namespace BlockSort {
 		return;
 	}
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	void swapBlocksRightSmallerThanLeft(T* array,
 										Descriptors<T> &descriptors,
 										array_size_t u,
 										array_size_t v,
-										SortMetrics *metrics) {
+										Metrics *metrics) {
 
 //		std::cout << __FUNCTION__ << std::endl;
 
@@ -616,11 +616,11 @@ namespace BlockSort {
 	 * 	This swaps block descriptors, but DOES NOT move the underlying array.
 	 * 	This will (most likely) result in the underlying keys being incorrect.
 	 */
-	template<typename T>
+	template <typename T, typename Metrics>
 	void swap_ONLY_BlockDescriptors(Descriptors<T> &descriptors,
 									array_size_t i,
 									array_size_t j,
-									SortMetrics *metrics) {
+									Metrics *metrics) {
 		//	The block descriptor has a copy of the array value at [key]
 		if (metrics) metrics += num_assignments_per_swap;
 		BlockDescriptor<T> temp = descriptors[i];
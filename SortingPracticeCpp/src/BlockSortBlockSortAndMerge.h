@@ -13,36 +13,36 @@
 namespace BlockSort {
 
 
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	using SortBlocksFunction = void (*)(T* array,
 										Descriptors<T> &blocks,
 										int num_blocks,
-										SortMetrics*);
+										Metrics*);
 
 	/*	Merges each pair of adjacent descriptors.  This maybe(?) necessary after a pass
 	 * through the array that combines adjacent descriptors to avoid having to regenerate
 	 * the descriptors each time the block size is doubled in a bottom up merge
 	 */
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	int mergeAdajacentPairsOfDescriptors(T* array,
 										 Descriptors<T> &descriptors,
 										 int num_descriptors,
-										 SortMetrics *metrics = nullptr);
+										 Metrics *metrics = nullptr);
 
 	/*	Starting with the leftmost A_Block, merge blocks
 	 * expects a set of descriptors that is in order by key	*/
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	void mergeAllBlocksLeftToRight(T* array,
 								   Descriptors<T> &block_descriptors,
 								   int num_blocks,
-								   SortMetrics *metrics = nullptr);
+								   Metrics *metrics = nullptr);
 
 	/*	Starting with the rightmost B_Block, merge blocks to the left	*/
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	void mergeAllBlocksRightToLeft(T* array,
 								   Descriptors<T> &block_descriptors,
 								   int num_blocks,
-								   SortMetrics *metrics = nullptr);
+								   Metrics *metrics = nullptr);
 
 	/*	Merge blocks using binary searches to identify spans to rotate
 	 * Although not strictly necessary, 'block_1_end' is passed to be consistent
@@ -62,51 +62,51 @@ namespace BlockSort {
 //									  array_size_t block_2_start, array_size_t block_2_end);
 
 	/*	sort an array of [start:end] by key, ignoring block type	*/
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	void sortBlocksByKey(		T* array,
 								array_size_t size,
 								Descriptors<T>&,
 								int first_block,
 								int last_block,
-								SortMetrics *metrics = nullptr);
+								Metrics *metrics = nullptr);
 
 	/*	sort an array of [A_0..A_m:B_0..B_n] using a binary search to find the
 	 * 	location where each of the blocks should go 							*/
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	void sortBlocksBinarySearch(T *array,
 								Descriptors<T> &descriptors,
 								int num_blocks,
-								SortMetrics *metrics = nullptr);
+								Metrics *metrics = nullptr);
 
 	/*	sort an array of [A_0..A_m:B_0..B_n] using a table to keep track of where
 	 * 	the displaced A_Blocks go in the upper portion (B_Block) of the array	*/
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	void sortBlocksByTable(		T* array,
 								Descriptors<T> &descriptors,
 								int num_blocks,
-								SortMetrics *metrics = nullptr);
+								Metrics *metrics = nullptr);
 
 	/*	sort an array of [A_0..A_m:B_0..B_n] using a binary search to find the
 	 * 	location where each of the blocks should go 							*/
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	void sortBlocksHybrid(		T* array,
 								Descriptors<T> &blocks,
 								int num_blocks,
-								SortMetrics *metrics = nullptr);
+								Metrics *metrics = nullptr);
 
 	/*	sort an array of [A_0..A_m:B_0..B_n] using an insertion sort			*/
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	void sortBlocksInsertion(	T* array,
 								Descriptors<T> &blocks,
 								int num_blocks,
-								SortMetrics *metrics = nullptr);
+								Metrics *metrics = nullptr);
 
 	/*	sort an array of blocks [A_0..A_m:B_0..Bn] starting at right A_m & B_n	*/
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	void sortBlocksRightToLeft(	T* array,
 								Descriptors<T> &blocks,
 								int num_blocks,
-								SortMetrics *metrics = nullptr);
+								Metrics *metrics = nullptr);
 
 
 	/*	**********************************************************************	*/
@@ -168,13 +168,13 @@ namespace BlockSort {
 	}
 
 	/*	Merge blocks using binary searches to identify spans to rotate	*/
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	void mergeTwoAdjacentBlocksByRotation(T* array,
 										  array_size_t block_1_start,
 										  array_size_t block_1_end,
 										  array_size_t block_2_start,
 										  array_size_t block2_end,
-										  SortMetrics *metrics = nullptr);
+										  Metrics *metrics = nullptr);
 
 
 	/*	********************************************************************* */
@@ -239,13 +239,13 @@ namespace BlockSort {
 	 *	highest element is the left start of the next 'B after A merge'.
 	 */
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	void mergeAllBlocksLeftToRight(T* array,
 								   Descriptors<T> &block_descriptors,
 								   int num_blocks,
-								   BlockOperations::MergeFunction<T>
+								   BlockOperations::MergeFunction<T, Metrics>
 										&mergeBlocks,
-								   SortMetrics *metrics) {
+								   Metrics *metrics) {
 		enum class ParsingState {
 			A_LOOKING_FOR_B,
 			B_LOOKING_FOR_A
@@ -323,11 +323,11 @@ namespace BlockSort {
 
 	//	starting at the right-most block, merge the previous (left) block into
 	//	  the elements to the right
-	template <typename T>
+	template <typename T, typename Metrics>
 	void mergeAllBlocksRightToLeft(	T* array,
 									Descriptors<T> &block_descriptors,
 									int num_blocks,
-									SortMetrics *metrics) {
+									Metrics *metrics) {
 
 		array_size_t sorted_span_start 	= block_descriptors[num_blocks-1].start_index;
 		array_size_t sorted_span_end	= block_descriptors[num_blocks-1].end_index;
@@ -367,11 +367,11 @@ namespace BlockSort {
 	 *		less efficient than starting at the rightmost B_Block and moving left one block at a time.
 	 */
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	void sortBlocksBinarySearch(T* array,
 								Descriptors<T> &blocks,
 								int num_blocks,
-								SortMetrics *metrics) {
+								Metrics *metrics) {
 
 		constexpr bool debug_verbose = false;
 
@@ -571,12 +571,12 @@ namespace BlockSort {
 	//	     a   c   c   d   e    3  'b'  1   a
 	//	     a   b   c   d   e    3
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	void sortBlocksByKey(	T* array,
 							array_size_t size,
 							Descriptors<T> &blocks,
 							int first_block, int last_block,
-							SortMetrics *metrics)
+							Metrics *metrics)
 	{
 		// insertion sort the A_Blocks
 		for (int i = first_block+1; i <= last_block; i++) {
@@ -624,11 +624,11 @@ namespace BlockSort {
 	 *	  B0:A AO:D A1:G B1:R B2:P A2:S   x  x  x   3   x   5    5    complete
 	 */
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	void sortBlocksByTable(	T* array,
 						  	Descriptors<T> &descriptors,
 							int num_blocks,
-							SortMetrics *metrics)
+							Metrics *metrics)
 	{
 		//	if all the descriptors are A_Blocks, they do not need to be sorted
 		if (descriptors[num_blocks-1].type == BlockType::A_BLOCK) {
@@ -725,11 +725,11 @@ namespace BlockSort {
 		 *    that is less than the next A_Block is probably close to where
 		 *    the previous B_Block was.
 		 */
-		template <typename T>
+		template <typename T, typename Metrics>
 		void sortBlocksHybrid(	T* array,
 								Descriptors<T> &blocks,
 								int num_blocks,
-								SortMetrics *metrics)
+								Metrics *metrics)
 		{
 			constexpr bool debug_verbose = false;
 
@@ -951,11 +951,11 @@ namespace BlockSort {
 	 * 		last B_Block on the right and moves one-at-a-time to the left
 	 */
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	void sortBlocksRightToLeft(	T *array,
 								Descriptors<T> &blocks,
 								int num_blocks,
-								SortMetrics *metrics) {
+								Metrics *metrics) {
 		constexpr bool debug_verbose = false;
 
 		#pragma push_macro("_debug")
@@ -0,0 +1,736 @@
+/*
+ * BlockSortInternalBuffer.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Joe Baker
+ */
+
+#ifndef BLOCKSORTINTERNALBUFFER_H_
+#define BLOCKSORTINTERNALBUFFER_H_
+
+#include <iostream>
+#include <iomanip>
+
+#include "SortingDataTypes.h"
+#include "SortingUtilities.h"
+#include "BlockOperations.h"
+#include "Rotation.h"
+
+/*
+ * 	A stable block merge sort that uses no memory outside of the array
+ * 	(Huang & Langston, 1988, as arranged in GrailSort).
+ *
+ * 	Before sorting, up to 2*sqrt(n) elements with distinct values are
+ * 	gathered at the front of the array.  The first sqrt(n) of them are
+ * 	'keys', which tag the blocks so that A blocks can be told apart from
+ * 	B blocks after the blocks are sorted, and which keep blocks with equal
+ * 	first elements in their original order.  The rest are a 'buffer':
+ * 	a merge swaps each element it takes into the buffer and the buffer's
+ * 	element into the hole, so a merge is n swaps and never rotates.  The
+ * 	buffer slides to the right through each merge and is moved back to
+ * 	the front once the merge is finished.
+ *
+ * 	Since the keys & buffer are distinct, the order they end up in does
+ * 	not matter.  When the sort is finished they are insertion sorted and
+ * 	merged back into the rest of the array by rotation.
+ *
+ * 	If there are not enough distinct values, the keys that were found are
+ * 	used both as tags and as a smaller buffer, and the merges that do not
+ * 	fit in the buffer are done with rotations, which are cheap when there
+ * 	are few distinct values.  With fewer than 4 distinct values, the whole
+ * 	array is merge sorted with rotations.
+ *
+ * 	The blocks are not described by BlockDescriptors, so nothing is
+ * 	allocated, and the sort takes O(n log n) compares and assignments.
+ */
+
+namespace BlockSort {
+namespace InternalBuffer {
+
+	//	Arrays shorter than this are insertion sorted
+	constexpr array_size_t min_size = 16;
+
+	//	The fewest distinct values that can be used as keys
+	constexpr array_size_t min_keys = 4;
+
+	//	Which sub-array a block came from, by its key
+	enum class Origin {
+		LEFT,
+		RIGHT,
+	};
+
+	//	The part of the current block that has not been merged yet
+	struct MergeState {
+		array_size_t length;
+		Origin		 origin;
+	};
+
+	/*	**********************************************************	*/
+	/*						function declarations					*/
+	/*	**********************************************************	*/
+
+	// Declare the functions with default parameter for SortMetrics*
+	template <typename T, typename Metrics = SortMetrics>
+	void sort(T* array, array_size_t size, Metrics *metrics = nullptr);
+
+	//	Moves up to 'ideal_keys' elements with distinct values to the front
+	//	  of [start:start+size-1], in order, and returns how many there were
+	template <typename T, typename Metrics = SortMetrics>
+	array_size_t collectKeys(T* array, array_size_t start, array_size_t size,
+							 array_size_t ideal_keys, Metrics *metrics = nullptr);
+
+	//	Sorts [start:start+size-1] into runs of 2*buffer_size, using the
+	//	  'buffer_size' elements to the left of 'start' as the buffer
+	template <typename T, typename Metrics = SortMetrics>
+	void buildRuns(T* array, array_size_t start, array_size_t size,
+				   array_size_t buffer_size, Metrics *metrics = nullptr);
+
+	//	Merges each pair of runs of 'run_size' in [start:start+size-1]
+	template <typename T, typename Metrics = SortMetrics>
+	void combineRuns(T* array, array_size_t first_key,
+					 array_size_t start, array_size_t size,
+					 array_size_t run_size, array_size_t block_size,
+					 bool has_buffer, Metrics *metrics = nullptr);
+
+	//	Merges the two runs [start:start+left_size-1] and the 'right_size'
+	//	  elements after them, through the buffer 'buffer_offset' to the left
+	template <typename T, typename Metrics = SortMetrics>
+	void mergeForwards(T* array, array_size_t start,
+					   array_size_t left_size, array_size_t right_size,
+					   array_size_t buffer_offset, Metrics *metrics = nullptr);
+
+	//	The same, through the buffer 'buffer_offset' to the right of the runs
+	template <typename T, typename Metrics = SortMetrics>
+	void mergeBackwards(T* array, array_size_t start,
+						array_size_t left_size, array_size_t right_size,
+						array_size_t buffer_offset, Metrics *metrics = nullptr);
+
+	//	Merges two adjacent runs with rotations instead of a buffer
+	template <typename T, typename Metrics = SortMetrics>
+	void mergeByRotation(T* array, array_size_t start,
+						 array_size_t left_size, array_size_t right_size,
+						 Metrics *metrics = nullptr);
+
+	//	Merge sorts [start:start+size-1] with rotations
+	template <typename T, typename Metrics = SortMetrics>
+	void sortByRotation(T* array, array_size_t start, array_size_t size,
+						Metrics *metrics = nullptr);
+
+	//	The offset of the first element of [start:start+size-1] that is
+	//	  >= 'value', or > 'value', or 'size' if there is none
+	template <typename T, typename Metrics = SortMetrics>
+	array_size_t searchFirst(T* array, array_size_t start, array_size_t size,
+							 T& value, Metrics *metrics = nullptr);
+
+	template <typename T, typename Metrics = SortMetrics>
+	array_size_t searchLast(T* array, array_size_t start, array_size_t size,
+							T& value, Metrics *metrics = nullptr);
+
+
+	/*	**********************************************************	*/
+	/*						function definitions					*/
+	/*	**********************************************************	*/
+
+	template <typename T, typename Metrics = SortMetrics>
+	void insertionSort(T* array, array_size_t start, array_size_t size,
+					   Metrics *metrics) {
+
+		for (array_size_t i = start+1; i < start+size; i++) {
+			for (array_size_t j = i; j > start; j--) {
+				if (metrics) metrics->compares++;
+				if (!(array[j] < array[j-1]))
+					break;
+				SortingUtilities::swap(array, j, j-1, metrics);
+			}
+		}
+	}
+
+	template <typename T, typename Metrics>
+	void sort(T* array, array_size_t size, Metrics *metrics) {
+
+		if (size < min_size) {
+			insertionSort(array, 0, size, metrics);
+			return;
+		}
+
+		//	the blocks are the smallest power of 2 >= sqrt(n), and each
+		//	  block of the array needs a key
+		array_size_t block_size = 1;
+		while (block_size * block_size < size) {
+			block_size *= 2;
+		}
+		array_size_t num_keys 	= (size-1) / block_size + 1;
+		array_size_t ideal_keys = num_keys + block_size;
+
+		array_size_t keys_found = collectKeys(array, 0, size, ideal_keys, metrics);
+
+		bool has_ideal_buffer = true;
+		if (keys_found < ideal_keys) {
+			if (keys_found < min_keys) {
+				sortByRotation(array, 0, size, metrics);
+				return;
+			}
+			//	the keys are the buffer while the runs are short, then
+			//	  half of them are the buffer for as long as the other half
+			//	  can tag the blocks, and after that there is no buffer
+			has_ideal_buffer = false;
+			num_keys		 = block_size;
+			block_size		 = 0;
+			while (num_keys > keys_found) {
+				num_keys /= 2;
+			}
+		}
+
+		array_size_t data_start = num_keys + block_size;
+		array_size_t data_size	= size - data_start;
+		array_size_t run_size	= has_ideal_buffer ? block_size : num_keys;
+
+		buildRuns(array, data_start, data_size, run_size, metrics);
+		run_size *= 2;
+
+		while (data_size > run_size) {
+			array_size_t merge_block_size	= block_size;
+			bool		 has_buffer			= has_ideal_buffer;
+			if (!has_ideal_buffer) {
+				array_size_t key_buffer_size = num_keys / 2;
+				if (key_buffer_size >= (2 * run_size) / key_buffer_size) {
+					merge_block_size = key_buffer_size;
+					has_buffer		 = true;
+				} else {
+					merge_block_size = (2 * run_size) / num_keys;
+				}
+			}
+			combineRuns(array, 0, data_start, data_size, run_size,
+						merge_block_size, has_buffer, metrics);
+			run_size *= 2;
+		}
+
+		//	put the keys & buffer back among the rest of the elements
+		insertionSort(array, 0, data_start, metrics);
+		mergeByRotation(array, 0, data_start, data_size, metrics);
+	}
+
+	/*
+	 * 	The keys found so far are kept together, in order, and are rotated
+	 * 	along with the search so that each new key is inserted next to them.
+	 * 	An element is a new key if it is not equal to any of them, so each
+	 * 	key is the first element with its value, which keeps the sort stable.
+	 */
+
+	template <typename T, typename Metrics>
+	array_size_t collectKeys(T* array, array_size_t start, array_size_t size,
+							 array_size_t ideal_keys, Metrics *metrics) {
+
+		array_size_t keys_found = 1;
+		array_size_t first_key	= 0;
+
+		for (array_size_t current = 1; current < size && keys_found < ideal_keys; current++) {
+			array_size_t insert_at = searchFirst(array, start + first_key, keys_found,
+												 array[start + current], metrics);
+			if (insert_at != keys_found) {
+				if (metrics) metrics->compares++;
+				if (!(array[start + current] < array[start + first_key + insert_at]))
+					continue;
+			}
+			//	move the keys up to the new key, then insert it among them
+			Rotation::rotate(array, start + first_key, keys_found,
+							 current - (first_key + keys_found), metrics);
+			first_key = current - keys_found;
+			Rotation::rotate(array, start + first_key + insert_at,
+							 keys_found - insert_at, 1, metrics);
+			keys_found++;
+		}
+		Rotation::rotate(array, start, first_key, keys_found, metrics);
+		return keys_found;
+	}
+
+	/*
+	 * 	Sorts pairs of elements while moving them 2 to the left, then merges
+	 * 	runs of 2, 4, ... buffer_size/2 while moving them left by the run
+	 * 	size, which leaves the buffer to their right.  The last level merges
+	 * 	from right to left and moves the runs back to where they started.
+	 */
+
+	template <typename T, typename Metrics>
+	void buildRuns(T* array, array_size_t start, array_size_t size,
+				   array_size_t buffer_size, Metrics *metrics) {
+
+		array_size_t i = 1;
+		for (; i < size; i += 2) {
+			array_size_t left  = start + i - 1;
+			array_size_t right = start + i;
+			if (metrics) metrics->compares++;
+			if (array[right] < array[left]) {
+				SortingUtilities::swap(array, left - 2, right, metrics);
+				SortingUtilities::swap(array, right - 2, left, metrics);
+			} else {
+				SortingUtilities::swap(array, left - 2, left, metrics);
+				SortingUtilities::swap(array, right - 2, right, metrics);
+			}
+		}
+		if (i - 1 < size) {
+			SortingUtilities::swap(array, start + i - 3, start + i - 1, metrics);
+		}
+		start -= 2;
+
+		for (array_size_t merge_size = 2; merge_size < buffer_size; merge_size *= 2) {
+			array_size_t full_merge = 2 * merge_size;
+			array_size_t merge_at	= start;
+			for (; merge_at + full_merge <= start + size; merge_at += full_merge) {
+				mergeForwards(array, merge_at, merge_size, merge_size, merge_size, metrics);
+			}
+			array_size_t left_over = start + size - merge_at;
+			if (left_over > merge_size) {
+				mergeForwards(array, merge_at, merge_size, left_over - merge_size,
+							  merge_size, metrics);
+			} else {
+				Rotation::rotate(array, merge_at - merge_size, merge_size, left_over, metrics);
+			}
+			start -= merge_size;
+		}
+
+		array_size_t full_merge = 2 * buffer_size;
+		array_size_t last_run	= size % full_merge;
+		array_size_t last_start = start + size - last_run;
+		if (last_run <= buffer_size) {
+			Rotation::rotate(array, last_start, last_run, buffer_size, metrics);
+		} else {
+			mergeBackwards(array, last_start, buffer_size, last_run - buffer_size,
+						   buffer_size, metrics);
+		}
+		for (array_size_t merge_at = last_start - full_merge;
+						  merge_at >= start;
+						  merge_at -= full_merge) {
+			mergeBackwards(array, merge_at, buffer_size, buffer_size, buffer_size, metrics);
+		}
+	}
+
+	template <typename T, typename Metrics>
+	void mergeForwards(T* array, array_size_t start,
+					   array_size_t left_size, array_size_t right_size,
+					   array_size_t buffer_offset, Metrics *metrics) {
+
+		array_size_t buffer = start - buffer_offset;
+		array_size_t left	= start;
+		array_size_t middle = start + left_size;
+		array_size_t right	= middle;
+		array_size_t end	= middle + right_size;
+
+		while (right < end) {
+			bool take_right = left == middle;
+			if (!take_right) {
+				if (metrics) metrics->compares++;
+				take_right = array[right] < array[left];
+			}
+			if (take_right) {
+				SortingUtilities::swap(array, buffer, right++, metrics);
+			} else {
+				SortingUtilities::swap(array, buffer, left++, metrics);
+			}
+			buffer++;
+		}
+		if (buffer != left) {
+			BlockOperations::swapBlockElementsOfEqualSize(array, buffer, left,
+														  middle - left, metrics);
+		}
+	}
+
+	template <typename T, typename Metrics>
+	void mergeBackwards(T* array, array_size_t start,
+						array_size_t left_size, array_size_t right_size,
+						array_size_t buffer_offset, Metrics *metrics) {
+
+		array_size_t left	= start + left_size - 1;
+		array_size_t middle = left;
+		array_size_t right	= middle + right_size;
+		array_size_t buffer = right + buffer_offset;
+
+		while (left >= start) {
+			bool take_left = right == middle;
+			if (!take_left) {
+				if (metrics) metrics->compares++;
+				take_left = array[right] < array[left];
+			}
+			if (take_left) {
+				SortingUtilities::swap(array, buffer, left--, metrics);
+			} else {
+				SortingUtilities::swap(array, buffer, right--, metrics);
+			}
+			buffer--;
+		}
+		while (right > middle && right != buffer) {
+			SortingUtilities::swap(array, buffer--, right--, metrics);
+		}
+	}
+
+	/*
+	 * 	The blocks of both runs are selection sorted by their first elements,
+	 * 	with their keys breaking ties, so equal elements stay in order.  A
+	 * 	block's key is less than the key of the first right run block if it
+	 * 	came from the left run.
+	 *
+	 * 	Walking the blocks left to right, a block from the same run as the
+	 * 	unmerged part before it is already in place.  A block from the other
+	 * 	run is merged with that unmerged part, and whatever is left of the
+	 * 	two becomes the new unmerged part.
+	 *
+	 * 	A trailing piece shorter than a block is merged with the blocks at
+	 * 	the end that are greater than its first element.
+	 */
+
+	template <typename T, typename Metrics = SortMetrics>
+	array_size_t selectSortBlocks(T* array, array_size_t first_key, array_size_t start,
+								  array_size_t median_key, array_size_t num_blocks,
+								  array_size_t block_size, Metrics *metrics) {
+
+		for (array_size_t first = 0; first < num_blocks; first++) {
+			array_size_t selected = first;
+			for (array_size_t current = first + 1; current < num_blocks; current++) {
+				T& current_value  = array[start + current  * block_size];
+				T& selected_value = array[start + selected * block_size];
+				if (metrics) metrics->compares++;
+				if (current_value < selected_value) {
+					selected = current;
+					continue;
+				}
+				if (metrics) metrics->compares++;
+				if (selected_value < current_value)
+					continue;
+				if (metrics) metrics->compares++;
+				if (array[first_key + current] < array[first_key + selected]) {
+					selected = current;
+				}
+			}
+			if (selected != first) {
+				BlockOperations::swapBlockElementsOfEqualSize(array,
+						start + first * block_size, start + selected * block_size,
+						block_size, metrics);
+				SortingUtilities::swap(array, first_key + first, first_key + selected, metrics);
+				if (median_key == first) {
+					median_key = selected;
+				} else if (median_key == selected) {
+					median_key = first;
+				}
+			}
+		}
+		return median_key;
+	}
+
+	template <typename T, typename Metrics = SortMetrics>
+	Origin originOf(T* array, array_size_t key, array_size_t median_key,
+					Metrics *metrics) {
+
+		if (metrics) metrics->compares++;
+		return array[key] < array[median_key] ? Origin::LEFT : Origin::RIGHT;
+	}
+
+	/*
+	 * 	Merges the unmerged part of the current block with the next block,
+	 * 	through the buffer.  Equal elements from the left run come first.
+	 */
+
+	template <typename T, typename Metrics = SortMetrics>
+	void mergeBlockThroughBuffer(T* array, array_size_t start, MergeState &current,
+								 array_size_t right_size, array_size_t buffer_offset,
+								 Metrics *metrics) {
+
+		array_size_t buffer = start - buffer_offset;
+		array_size_t left	= start;
+		array_size_t middle = start + current.length;
+		array_size_t right	= middle;
+		array_size_t end	= middle + right_size;
+
+		while (left < middle && right < end) {
+			if (metrics) metrics->compares++;
+			bool take_left = current.origin == Origin::LEFT ?
+							 !(array[right] < array[left]) :
+							 array[left] < array[right];
+			if (take_left) {
+				SortingUtilities::swap(array, buffer, left++, metrics);
+			} else {
+				SortingUtilities::swap(array, buffer, right++, metrics);
+			}
+			buffer++;
+		}
+
+		if (left < middle) {
+			current.length = middle - left;
+			//	move what is left of the current block to the end
+			for (array_size_t from = middle - 1, to = end - 1; from >= left; from--, to--) {
+				SortingUtilities::swap(array, to, from, metrics);
+			}
+		} else {
+			current.length = end - right;
+			current.origin = current.origin == Origin::LEFT ? Origin::RIGHT : Origin::LEFT;
+		}
+	}
+
+	//	The same merge, with rotations
+	template <typename T, typename Metrics = SortMetrics>
+	void mergeBlockByRotation(T* array, array_size_t start, MergeState &current,
+							  array_size_t right_size, Metrics *metrics) {
+
+		array_size_t left_size	= current.length;
+		array_size_t middle		= start + left_size;
+		bool		 left_first = current.origin == Origin::LEFT;
+
+		if (metrics) metrics->compares++;
+		bool in_order = left_first ? !(array[middle] < array[middle-1]) :
+									 array[middle-1] < array[middle];
+		if (!in_order) {
+			while (left_size != 0) {
+				array_size_t merge_size = left_first ?
+						searchFirst(array, middle, right_size, array[start], metrics) :
+						searchLast (array, middle, right_size, array[start], metrics);
+				if (merge_size != 0) {
+					Rotation::rotate(array, start, left_size, merge_size, metrics);
+					start		+= merge_size;
+					middle		+= merge_size;
+					right_size	-= merge_size;
+				}
+				if (right_size == 0) {
+					current.length = left_size;
+					return;
+				}
+				do {
+					start++;
+					left_size--;
+					if (left_size == 0)
+						break;
+					if (metrics) metrics->compares++;
+				} while (left_first ? !(array[middle] < array[start]) :
+									  array[start] < array[middle]);
+			}
+		}
+		current.length = right_size;
+		current.origin = left_first ? Origin::RIGHT : Origin::LEFT;
+	}
+
+	template <typename T, typename Metrics = SortMetrics>
+	void mergeBlocks(T* array, array_size_t first_key, array_size_t median_key,
+					 array_size_t start, array_size_t num_blocks, array_size_t block_size,
+					 array_size_t last_merge_blocks, array_size_t last_size,
+					 bool has_buffer, Metrics *metrics) {
+
+		MergeState	 current	= { block_size, originOf(array, first_key, median_key, metrics) };
+		array_size_t next_block = start + block_size;
+
+		for (array_size_t key = 1; key < num_blocks; key++, next_block += block_size) {
+			array_size_t current_block = next_block - current.length;
+			Origin next_origin = originOf(array, first_key + key, median_key, metrics);
+
+			if (next_origin == current.origin) {
+				if (has_buffer) {
+					BlockOperations::swapBlockElementsOfEqualSize(array,
+							current_block - block_size, current_block,
+							current.length, metrics);
+				}
+				current.length = block_size;
+			} else if (has_buffer) {
+				mergeBlockThroughBuffer(array, current_block, current, block_size,
+										block_size, metrics);
+			} else if (current.length != 0) {
+				mergeBlockByRotation(array, current_block, current, block_size, metrics);
+			}
+		}
+
+		array_size_t current_block = next_block - current.length;
+		if (last_size != 0) {
+			if (current.origin == Origin::RIGHT) {
+				if (has_buffer) {
+					BlockOperations::swapBlockElementsOfEqualSize(array,
+							current_block - block_size, current_block,
+							current.length, metrics);
+				}
+				current_block  = next_block;
+				current.length = block_size * last_merge_blocks;
+			} else {
+				current.length += block_size * last_merge_blocks;
+			}
+			if (has_buffer) {
+				mergeForwards(array, current_block, current.length, last_size,
+							  block_size, metrics);
+			} else {
+				mergeByRotation(array, current_block, current.length, last_size, metrics);
+			}
+		} else if (has_buffer) {
+			BlockOperations::swapBlockElementsOfEqualSize(array,
+					current_block - block_size, current_block,
+					current.length, metrics);
+		}
+	}
+
+	template <typename T, typename Metrics>
+	void combineRuns(T* array, array_size_t first_key,
+					 array_size_t start, array_size_t size,
+					 array_size_t run_size, array_size_t block_size,
+					 bool has_buffer, Metrics *metrics) {
+
+		array_size_t full_merge = 2 * run_size;
+		array_size_t num_merges = size / full_merge;
+		array_size_t last_runs	= size - full_merge * num_merges;
+
+		//	a last run that is not followed by another is already sorted
+		if (last_runs <= run_size) {
+			size	 -= last_runs;
+			last_runs = 0;
+		}
+
+		for (array_size_t merge = 0; merge < num_merges; merge++) {
+			array_size_t offset		= start + merge * full_merge;
+			array_size_t num_blocks = full_merge / block_size;
+			insertionSort(array, first_key, num_blocks, metrics);
+			array_size_t median_key = selectSortBlocks(array, first_key, offset,
+													   run_size / block_size,
+													   num_blocks, block_size, metrics);
+			mergeBlocks(array, first_key, first_key + median_key, offset,
+						num_blocks, block_size, 0, 0, has_buffer, metrics);
+		}
+
+		if (last_runs != 0) {
+			array_size_t offset		= start + num_merges * full_merge;
+			array_size_t num_blocks = last_runs / block_size;
+			insertionSort(array, first_key, num_blocks + 1, metrics);
+			array_size_t median_key = selectSortBlocks(array, first_key, offset,
+													   run_size / block_size,
+													   num_blocks, block_size, metrics);
+
+			//	the blocks at the end that are greater than the first element
+			//	  of the trailing piece are merged with it
+			array_size_t last_size			= last_runs - num_blocks * block_size;
+			array_size_t last_merge_blocks	= 0;
+			if (last_size != 0) {
+				array_size_t last_piece = offset + num_blocks * block_size;
+				array_size_t prev_block = last_piece - block_size;
+				while (last_merge_blocks < num_blocks) {
+					if (metrics) metrics->compares++;
+					if (!(array[last_piece] < array[prev_block]))
+						break;
+					last_merge_blocks++;
+					prev_block -= block_size;
+				}
+			}
+
+			array_size_t num_leading_blocks = num_blocks - last_merge_blocks;
+			if (num_leading_blocks == 0) {
+				array_size_t left_size = last_merge_blocks * block_size;
+				if (has_buffer) {
+					mergeForwards(array, offset, left_size, last_size, block_size, metrics);
+				} else {
+					mergeByRotation(array, offset, left_size, last_size, metrics);
+				}
+			} else {
+				mergeBlocks(array, first_key, first_key + median_key, offset,
+							num_leading_blocks, block_size, last_merge_blocks,
+							last_size, has_buffer, metrics);
+			}
+		}
+
+		//	the buffer has moved to the end of the merged runs
+		if (has_buffer) {
+			for (array_size_t i = start + size - 1; i >= start; i--) {
+				SortingUtilities::swap(array, i, i - block_size, metrics);
+			}
+		}
+	}
+
+	template <typename T, typename Metrics>
+	void mergeByRotation(T* array, array_size_t start,
+						 array_size_t left_size, array_size_t right_size,
+						 Metrics *metrics) {
+
+		if (left_size < right_size) {
+			//	insert groups of the right run into the left run
+			array_size_t middle = start + left_size;
+			while (left_size != 0) {
+				array_size_t merge_size = searchFirst(array, middle, right_size,
+													  array[start], metrics);
+				if (merge_size != 0) {
+					Rotation::rotate(array, start, left_size, merge_size, metrics);
+					start		+= merge_size;
+					middle		+= merge_size;
+					right_size	-= merge_size;
+				}
+				if (right_size == 0)
+					break;
+				do {
+					start++;
+					left_size--;
+					if (left_size == 0)
+						break;
+					if (metrics) metrics->compares++;
+				} while (!(array[middle] < array[start]));
+			}
+		} else {
+			//	insert groups of the left run into the right run, from the end
+			array_size_t end = start + left_size + right_size - 1;
+			while (right_size != 0) {
+				array_size_t merge_size = searchLast(array, start, left_size,
+													 array[end], metrics);
+				if (merge_size != left_size) {
+					Rotation::rotate(array, start + merge_size, left_size - merge_size,
+									 right_size, metrics);
+					end		 -= left_size - merge_size;
+					left_size = merge_size;
+				}
+				if (left_size == 0)
+					break;
+				array_size_t middle = start + left_size;
+				do {
+					right_size--;
+					end--;
+					if (right_size == 0)
+						break;
+					if (metrics) metrics->compares++;
+				} while (!(array[end] < array[middle - 1]));
+			}
+		}
+	}
+
+	template <typename T, typename Metrics>
+	void sortByRotation(T* array, array_size_t start, array_size_t size,
+						Metrics *metrics) {
+
+		for (array_size_t i = 1; i < size; i += 2) {
+			if (metrics) metrics->compares++;
+			if (array[start + i] < array[start + i - 1]) {
+				SortingUtilities::swap(array, start + i - 1, start + i, metrics);
+			}
+		}
+		for (array_size_t merge_size = 2; merge_size < size; merge_size *= 2) {
+			array_size_t full_merge = 2 * merge_size;
+			array_size_t merge_at	= 0;
+			for (; merge_at + full_merge <= size; merge_at += full_merge) {
+				mergeByRotation(array, start + merge_at, merge_size, merge_size, metrics);
+			}
+			array_size_t left_over = size - merge_at;
+			if (left_over > merge_size) {
+				mergeByRotation(array, start + merge_at, merge_size,
+								left_over - merge_size, metrics);
+			}
+		}
+	}
+
+	template <typename T, typename Metrics>
+	array_size_t searchFirst(T* array, array_size_t start, array_size_t size,
+							 T& value, Metrics *metrics) {
+
+		if (size == 0)
+			return 0;
+		return SortingUtilities::binarySearchFirstElement(array, start, start + size - 1,
+														  value, metrics) - start;
+	}
+
+	template <typename T, typename Metrics>
+	array_size_t searchLast(T* array, array_size_t start, array_size_t size,
+							T& value, Metrics *metrics) {
+
+		if (size == 0)
+			return 0;
+		return SortingUtilities::binarySearchLastElement(array, start, start + size - 1,
+														 value, metrics) - start;
+	}
+}	// namespace InternalBuffer
+}	// namespace BlockSort
+
+#endif /* BLOCKSORTINTERNALBUFFER_H_ */
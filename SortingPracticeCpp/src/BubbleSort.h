@@ -19,16 +19,16 @@ namespace BubbleSort {
 	/*	**********************************************************************	*/
 
 	//	Declare the function with a default value for the SortMetrics pointer
-	template <typename T>
-	void sort(T* array, array_size_t size, SortMetrics *metrics = nullptr);
+	template <typename T, typename Metrics = SortMetrics>
+	void sort(T* array, array_size_t size, Metrics *metrics = nullptr);
 
 
 	/*	**********************************************************************	*/
 	/*								function definition							*/
 	/*	**********************************************************************	*/
 
-	template <typename T>
-	void sort(T* array, array_size_t size, SortMetrics *metrics) {
+	template <typename T, typename Metrics>
+	void sort(T* array, array_size_t size, Metrics *metrics) {
 
 		for (array_size_t lowest_unsorted = 0; lowest_unsorted != size-1; lowest_unsorted++) {
 			bool was_swap = false;
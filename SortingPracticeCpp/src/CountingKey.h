@@ -0,0 +1,128 @@
+/*
+ * CountingKey.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Joe Baker
+ */
+
+/*	A SortingDataType that counts what is done to it.  Every comparison
+ *	  is one compare, and every copy or move, by constructor or by
+ *	  assignment, is one assignment.  The counts go to the calling
+ *	  thread's ThreadMetrics counters.
+ *
+ *	The sorts count by hand, and not all the same way:  a swap is 3
+ *	  assignments in one sort & uncounted in another, and an isSorted()
+ *	  check may or may not be counted.  Sorting CountingKeys counts every
+ *	  sort by the same rules, including sorts that do not count at all,
+ *	  like std::sort.
+ *
+ *		ThreadMetrics::resetAllThreads();
+ *		std::sort(keys, keys + size);
+ *		SortMetrics counts = ThreadMetrics::allThreads();
+ *
+ *	allThreads() adds up the counters of every thread, so the work done
+ *	  by the workers of a parallel sort is included.  thisThread() is
+ *	  only the calling thread's.
+ */
+
+#ifndef COUNTINGKEY_H_
+#define COUNTINGKEY_H_
+
+#include <utility>
+
+#include "SortingDataTypes.h"
+#include "SortTestMetrics.h"
+#include "RadixSort.h"
+
+template <typename T>
+class CountingKey : public SortingDataType<T> {
+private:
+	inline static ThreadMetrics s_metrics;
+
+	static void countCompare(void)		{	s_metrics.compares++;		}
+	static void countAssignment(void)	{	s_metrics.assignments++;	}
+
+public:
+	using SortingDataType<T>::operator=;
+
+	/*	constructors and copy / move operators	*/
+
+	CountingKey() : SortingDataType<T>() {}
+
+	CountingKey(const CountingKey &other) : SortingDataType<T>(other) {
+		countAssignment();
+	}
+
+	CountingKey(CountingKey &&other) : SortingDataType<T>(std::move(other)) {
+		countAssignment();
+	}
+
+	CountingKey& operator=(const CountingKey &other) {
+		countAssignment();
+		SortingDataType<T>::operator=(other);
+		return *this;
+	}
+
+	CountingKey& operator=(CountingKey &&other) {
+		countAssignment();
+		SortingDataType<T>::operator=(std::move(other));
+		return *this;
+	}
+
+	~CountingKey() {}
+
+	/*	comparing the underlying element, one compare each	*/
+
+	bool operator==(const CountingKey &other) const {
+		countCompare();
+		return this->value == other.value;
+	}
+
+	bool operator!=(const CountingKey &other) const {
+		countCompare();
+		return !(this->value == other.value);
+	}
+
+	bool operator<(const CountingKey &other) const {
+		countCompare();
+		return this->value < other.value;
+	}
+
+	bool operator<=(const CountingKey &other) const {
+		countCompare();
+		return !(other.value < this->value);
+	}
+
+	bool operator>(const CountingKey &other) const {
+		countCompare();
+		return other.value < this->value;
+	}
+
+	bool operator>=(const CountingKey &other) const {
+		countCompare();
+		return !(this->value < other.value);
+	}
+};
+
+//	The data members are those of SortingDataType, so that arrays of
+//	  the two are laid out the same
+static_assert(sizeof(CountingKey<int>) == sizeof(SortingDataType<int>),
+			  "CountingKey must not add data members");
+
+template <typename T>
+constexpr bool is_counting_key = false;
+
+template <typename U>
+constexpr bool is_counting_key<CountingKey<U>> = true;
+
+namespace RadixSort {
+
+	//	A CountingKey is radix sorted on its 'value', like a SortingDataType
+	template <typename U>
+	struct RadixElement<CountingKey<U>> {
+		using key_t = U;
+		static const U& key(const CountingKey<U>& element) { return element.value; }
+	};
+}
+
+#endif /* COUNTINGKEY_H_ */
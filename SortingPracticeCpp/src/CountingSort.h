@@ -0,0 +1,263 @@
+/*
+ * CountingSort.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Joe Baker
+ *
+ *      A stable counting sort for arrays whose keys span a small
+ *        range of integers or take only a few distinct values
+ */
+
+#ifndef COUNTINGSORT_H_
+#define COUNTINGSORT_H_
+
+#include <iostream>
+#include <iomanip>
+#include <type_traits>
+#include <vector>
+
+#include "SortingDataTypes.h"
+#include "SortingUtilities.h"
+#include "ScratchBuffer.h"
+#include "MergeSort.h"
+#include "RadixSort.h"		// RadixElement<T>, which extracts the key
+
+/*
+ * 	The key range (integers) or the set of distinct keys (anything else)
+ * 	is found in one pass over the array.  When the range or the number of
+ * 	distinct keys is small, each key is assigned a bucket, the buckets are
+ * 	counted, the counts are converted into each bucket's starting position,
+ * 	and the elements are scattered, in order, into their buckets.
+ *
+ * 	When there are too many buckets for counting to pay off, the array is
+ * 	sorted with MergeSort, which is also stable.
+ */
+
+namespace CountingSort {
+
+	//	An integer key range is counted directly if it is no wider than
+	//	  this many buckets per element, or than min_histogram_size
+	constexpr array_size_t max_buckets_per_element	= 2;
+	constexpr array_size_t min_histogram_size		= 256;
+
+	//	The largest table of distinct non-integer keys that will be built
+	constexpr array_size_t max_distinct_values		= 256;
+
+	/*	**************************************************************	*/
+	/*						function declarations						*/
+	/*	**************************************************************	*/
+
+	// Declare function with default value for SortMetrics pointer
+	template <typename T, typename Metrics = SortMetrics>
+	void sort(T* array, array_size_t size, Metrics *metrics = nullptr);
+
+	//	Stable scatter of the array into buckets [0:num_buckets)
+	template <typename T, typename Metrics = SortMetrics>
+	void scatterIntoBuckets(T* array, array_size_t size,
+							const std::vector<array_size_t> &bucket_of,
+							array_size_t num_buckets,
+							Metrics *metrics = nullptr);
+
+	//	Returns false, without moving anything, if the key range is too wide
+	template <typename T, typename Metrics = SortMetrics>
+	bool sortByKeyRange(T* array, array_size_t size, Metrics *metrics = nullptr);
+
+	//	Returns false, without moving anything, if there are too many distinct keys
+	template <typename T, typename Metrics = SortMetrics>
+	bool sortByDistinctKeys(T* array, array_size_t size, Metrics *metrics = nullptr);
+
+
+	/*	**************************************************************	*/
+	/*						function definitions						*/
+	/*	**************************************************************	*/
+
+	/*
+	 * 	Wrapper to match convention of other sort algorithms
+	 */
+
+	template <typename T, typename Metrics>
+	void sort(T* array, array_size_t size, Metrics *metrics) {
+
+		using Key = typename RadixSort::RadixElement<T>::key_t;
+
+		if (size <= 1) {
+			return;
+		}
+
+		if constexpr (std::is_integral<Key>::value) {
+			if (sortByKeyRange(array, size, metrics)) {
+				return;
+			}
+		}
+		if (sortByDistinctKeys(array, size, metrics)) {
+			return;
+		}
+		MergeSort::sort(array, size, metrics);
+	}
+
+	/*
+	 * 	One pass finds the smallest and largest key.  Each element's bucket
+	 * 	is its key's distance from the smallest key.
+	 */
+
+	template <typename T, typename Metrics>
+	bool sortByKeyRange(T* array, array_size_t size, Metrics *metrics) {
+
+		using Element	= RadixSort::RadixElement<T>;
+		using Key 		= typename Element::key_t;
+
+		Key min_key = Element::key(array[0]);
+		Key max_key = Element::key(array[0]);
+		for (array_size_t i = 1; i != size; i++) {
+			const Key& key = Element::key(array[i]);
+			if (metrics) metrics->compares++;
+			if (key < min_key) {
+				min_key = key;
+				continue;
+			}
+			if (metrics) metrics->compares++;
+			if (key > max_key) {
+				max_key = key;
+			}
+		}
+
+		//	unsigned arithmetic is exact for any range that fits in 64 bits
+		unsigned long long range =
+				static_cast<unsigned long long>(max_key) -
+				static_cast<unsigned long long>(min_key);
+		array_size_t max_buckets = max_buckets_per_element * size;
+		if (max_buckets < min_histogram_size) {
+			max_buckets = min_histogram_size;
+		}
+		if (range >= static_cast<unsigned long long>(max_buckets)) {
+			return false;
+		}
+
+		std::vector<array_size_t> bucket_of(size);
+		for (array_size_t i = 0; i != size; i++) {
+			bucket_of[i] = static_cast<array_size_t>(
+					static_cast<unsigned long long>(Element::key(array[i])) -
+					static_cast<unsigned long long>(min_key));
+		}
+		scatterIntoBuckets(array, size, bucket_of,
+						   static_cast<array_size_t>(range) + 1, metrics);
+		return true;
+	}
+
+	/*
+	 * 	One pass builds an ordered table of the distinct keys.  A second pass
+	 * 	looks up each element's key in the table to get its bucket.  Keys often
+	 * 	arrive in runs of identical values, so the previous element's bucket
+	 * 	is tried before searching the table.
+	 */
+
+	template <typename T, typename Metrics>
+	bool sortByDistinctKeys(T* array, array_size_t size, Metrics *metrics) {
+
+		using Element	= RadixSort::RadixElement<T>;
+		using Key 		= typename Element::key_t;
+
+		std::vector<Key> distinct_keys;
+
+		//	returns the index of the first key in the table that is >= 'key'
+		auto search_table = [&] (const Key& key) -> array_size_t {
+			array_size_t lo = 0;
+			array_size_t hi = distinct_keys.size();
+			while (lo != hi) {
+				array_size_t mid = lo + (hi-lo)/2;
+				if (metrics) metrics->compares++;
+				if (distinct_keys[mid] < key) {
+					lo = mid+1;
+				} else {
+					hi = mid;
+				}
+			}
+			return lo;
+		};
+
+		//	true if 'key' is in the table at 'bucket'
+		auto is_in_bucket = [&] (const Key& key, array_size_t bucket) -> bool {
+			if (bucket == static_cast<array_size_t>(distinct_keys.size())) {
+				return false;
+			}
+			if (metrics) metrics->compares++;
+			return distinct_keys[bucket] == key;
+		};
+
+		//	first pass: find the distinct keys
+		array_size_t bucket = 0;
+		for (array_size_t i = 0; i != size; i++) {
+			const Key& key = Element::key(array[i]);
+			if (is_in_bucket(key, bucket)) {
+				continue;
+			}
+			bucket = search_table(key);
+			if (is_in_bucket(key, bucket)) {
+				continue;
+			}
+			if (static_cast<array_size_t>(distinct_keys.size()) == max_distinct_values) {
+				return false;
+			}
+			distinct_keys.insert(distinct_keys.begin() + bucket, key);
+		}
+
+		//	a single key means the array is already in order
+		if (distinct_keys.size() == 1) {
+			return true;
+		}
+
+		//	second pass: every key is in the table, so the search finds it
+		std::vector<array_size_t> bucket_of(size);
+		bucket = 0;
+		for (array_size_t i = 0; i != size; i++) {
+			const Key& key = Element::key(array[i]);
+			if (!is_in_bucket(key, bucket)) {
+				bucket = search_table(key);
+			}
+			bucket_of[i] = bucket;
+		}
+		scatterIntoBuckets(array, size, bucket_of, distinct_keys.size(), metrics);
+		return true;
+	}
+
+	/*
+	 * 	Counts the elements in each bucket, converts the counts into the
+	 * 	position of each bucket's first element, then copies the elements
+	 * 	left to right into their bucket, which keeps equal keys in order.
+	 */
+
+	template <typename T, typename Metrics>
+	void scatterIntoBuckets(T* array, array_size_t size,
+							const std::vector<array_size_t> &bucket_of,
+							array_size_t num_buckets,
+							Metrics *metrics) {
+
+		std::vector<array_size_t> bucket_start(num_buckets, 0);
+		for (array_size_t i = 0; i != size; i++) {
+			bucket_start[bucket_of[i]]++;
+		}
+
+		//	If every element is in one bucket, the array is already in order
+		if (bucket_start[bucket_of[0]] == size) {
+			return;
+		}
+
+		array_size_t position = 0;
+		for (array_size_t b = 0; b != num_buckets; b++) {
+			array_size_t count 	= bucket_start[b];
+			bucket_start[b] 	= position;
+			position 		   += count;
+		}
+
+		ScratchLease<T> aux(size);
+		for (array_size_t i = 0; i != size; i++) {
+			aux[bucket_start[bucket_of[i]]++] = array[i];
+		}
+		for (array_size_t i = 0; i != size; i++) {
+			array[i] = aux[i];
+		}
+		if (metrics) metrics->assignments += 2*size;
+	}
+}	// namespace CountingSort
+
+#endif /* COUNTINGSORT_H_ */
@@ -0,0 +1,251 @@
+/*
+ * DualPivotQuickSort.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Joe Baker
+ */
+
+#ifndef DUALPIVOTQUICKSORT_H_
+#define DUALPIVOTQUICKSORT_H_
+
+#include <iostream>
+#include <iomanip>
+
+#include "SortingDataTypes.h"
+#include "SortingUtilities.h"
+#include "SimdSortingNetwork.h"
+#include "HeapSort.h"
+#include "IntegerArithmetic.h"
+
+/*
+ * 	This is Yaroslavskiy's dual pivot quick sort.  Two pivots, p <= q,
+ * 	split each span three ways in a single scan:
+ *
+ * 		[ < p : p : p <= x <= q : q : > q ]
+ *
+ * 	The pivots are the elements 1/3rd and 2/3rds of the way through the span,
+ * 	which keeps sorted and reverse ordered arrays from being quadratic.
+ * 	If the pivots are equal, every element of the middle third is equal to
+ * 	them and the middle third is not partitioned any further.
+ *
+ * 	The two smaller parts are sorted recursively and the largest in a
+ * 	loop, so the stack is at most log2(n) deep.  Inputs can still be made
+ * 	that put the pivots near the ends of every span, so after
+ * 	2*floorLog2(n) levels the span is heap sorted, as in
+ * 	ProtectedQuickSort::introSort().
+ */
+
+namespace DualPivotQuickSort {
+
+	// Below a certain size, do an insertion sort rather
+	//	than all the overhead of partitioning
+	constexpr array_size_t max_size_to_cutoff_to_insertion_sort = 16;
+
+	//	The depth_limit to partitionArray() that never falls back to heap sort
+	constexpr int unlimited_depth = -1;
+
+	/*	**********************************************************	*/
+	/*						function declarations					*/
+	/*	**********************************************************	*/
+
+	// Declare the functions with default parameter for SortMetrics*
+	template <typename T, typename Metrics = SortMetrics>
+	void partitionArray(T* array, array_size_t start, array_size_t end,
+					    Metrics *metrics = nullptr,
+						int depth_limit = unlimited_depth);
+
+	template <typename T, typename Metrics = SortMetrics>
+	void sort(T* array, array_size_t size,
+			  Metrics *metrics = nullptr);
+
+	//	Moves the elements equal to p or q out of [middle_start:middle_end]
+	template <typename T, typename Metrics = SortMetrics>
+	void squeezeOutPivots(T* array, array_size_t p, array_size_t q,
+						  array_size_t &middle_start, array_size_t &middle_end,
+						  Metrics *metrics = nullptr);
+
+
+	/*	**********************************************************	*/
+	/*						function definitions					*/
+	/*	**********************************************************	*/
+
+	template <typename T, typename Metrics>
+	void sort(T* array, array_size_t size, Metrics *metrics) {
+
+		if (size <= 1)
+			return;
+
+		partitionArray(array, 0, size-1, metrics, 2*floorLog2(size));
+		return;
+	}
+
+
+	/*
+	 * 	Partition array recursively into [ < p : p <= x <= q : > q ]
+	 *
+	 * 	Each level decrements depth_limit.  When it reaches zero, the
+	 * 	span is heap sorted rather than partitioned again.
+	 */
+
+	template <typename T, typename Metrics>
+	void partitionArray(T* array, array_size_t start, array_size_t end,
+						Metrics *metrics, int depth_limit) {
+
+		while (end > start) {
+
+			array_size_t span = end-start+1;
+
+			// if array is small enough do an insertion sort,
+			//  or a sorting network for primitive types
+			if (span <= max_size_to_cutoff_to_insertion_sort) {
+				SimdSortingNetwork::sort(&array[start], span, metrics);
+				return;
+			}
+
+			if (depth_limit == 0) {
+				HeapSort::sort(&array[start], span, metrics);
+				return;
+			}
+			if (depth_limit != unlimited_depth) {
+				depth_limit--;
+			}
+
+			// move the pivots into [start] and [end] with p <= q
+			array_size_t third = span/3;
+			SortingUtilities::swap(array, start, start + third, metrics);
+			SortingUtilities::swap(array, end, end - third, metrics);
+			if (metrics) metrics->compares++;
+			if (array[start] > array[end]) {
+				SortingUtilities::swap(array, start, end, metrics);
+			}
+
+			//	[start+1:lower-1] < p
+			//	[lower:i-1] 	  p <= x <= q
+			//	[i:upper]		  have not been examined
+			//	[upper+1:end-1]   > q
+			array_size_t lower = start+1;
+			array_size_t upper = end-1;
+			array_size_t i	   = lower;
+
+			while (i <= upper) {
+				if (metrics) metrics->compares++;
+				if (array[i] < array[start]) {
+					// until a middle element is found, i and lower are the same
+					if (i != lower) {
+						SortingUtilities::swap(array, i, lower, metrics);
+					}
+					lower++;
+				} else {
+					if (metrics) metrics->compares++;
+					if (array[i] > array[end]) {
+						// find an element from the right that is <= q
+						while (i < upper) {
+							if (metrics) metrics->compares++;
+							if (!(array[upper] > array[end]))
+								break;
+							upper--;
+						}
+						if (i != upper) {
+							SortingUtilities::swap(array, i, upper, metrics);
+						}
+						upper--;
+						// the element that came from the right may be < p
+						if (metrics) metrics->compares++;
+						if (array[i] < array[start]) {
+							if (i != lower) {
+								SortingUtilities::swap(array, i, lower, metrics);
+							}
+							lower++;
+						}
+					}
+				}
+				i++;
+			}
+
+			// move the pivots into their final positions
+			lower--;
+			upper++;
+			if (lower != start) {
+				SortingUtilities::swap(array, start, lower, metrics);
+			}
+			if (upper != end) {
+				SortingUtilities::swap(array, end, upper, metrics);
+			}
+
+			// if p == q, every element between them is equal to both
+			array_size_t middle_start = lower+1;
+			array_size_t middle_end	  = lower;
+			if (metrics) metrics->compares++;
+			if (array[lower] < array[upper]) {
+				middle_end = upper-1;
+				if (middle_end - middle_start + 1 > 2*span/3) {
+					squeezeOutPivots(array, lower, upper, middle_start, middle_end, metrics);
+				}
+			}
+
+			// sort the two smaller parts, and loop on the largest
+			array_size_t left_span	 = lower-start;
+			array_size_t middle_span = middle_end-middle_start+1;
+			array_size_t right_span	 = end-upper;
+			if (left_span >= middle_span && left_span >= right_span) {
+				partitionArray(array, middle_start, middle_end, metrics, depth_limit);
+				partitionArray(array, upper+1, end, metrics, depth_limit);
+				end	  = lower-1;
+			} else if (middle_span >= right_span) {
+				partitionArray(array, start, lower-1, metrics, depth_limit);
+				partitionArray(array, upper+1, end, metrics, depth_limit);
+				start = middle_start;
+				end	  = middle_end;
+			} else {
+				partitionArray(array, start, lower-1, metrics, depth_limit);
+				partitionArray(array, middle_start, middle_end, metrics, depth_limit);
+				start = upper+1;
+			}
+		}
+	}
+
+	/*
+	 * 	When there are many duplicate keys, most of a span can end up
+	 * 	between the pivots, and much of that is often equal to a pivot.
+	 * 	Elements equal to p are moved to the left end of the middle,
+	 * 	elements equal to q to the right end, and the bounds of the middle
+	 * 	are pulled in past them.  Every element of the middle is >= p and
+	 * 	<= q, so a single compare against each pivot is enough.
+	 */
+
+	template <typename T, typename Metrics>
+	void squeezeOutPivots(T* array, array_size_t p, array_size_t q,
+						  array_size_t &middle_start, array_size_t &middle_end,
+						  Metrics *metrics) {
+
+		array_size_t lower = middle_start;
+		array_size_t upper = middle_end;
+		array_size_t i	   = lower;
+
+		while (i <= upper) {
+			if (metrics) metrics->compares++;
+			if (!(array[p] < array[i])) {
+				if (i != lower) {
+					SortingUtilities::swap(array, i, lower, metrics);
+				}
+				lower++;
+				i++;
+				continue;
+			}
+			if (metrics) metrics->compares++;
+			if (!(array[i] < array[q])) {
+				if (i != upper) {
+					SortingUtilities::swap(array, i, upper, metrics);
+				}
+				upper--;
+				continue;
+			}
+			i++;
+		}
+
+		middle_start = lower;
+		middle_end	 = upper;
+	}
+}
+
+#endif /* DUALPIVOTQUICKSORT_H_ */
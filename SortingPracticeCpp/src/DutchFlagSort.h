@@ -14,6 +14,7 @@
 #include "SortingDataTypes.h"
 #include "SortingUtilities.h"
 #include "InsertionSort.h"
+#include "SortingNetworks.h"
 
 #pragma push_macro("debug_verbose")
 #define debug_verbose false
@@ -59,12 +60,12 @@ namespace DutchFlagSort {
 	/*	**********************************************************************	*/
 
 	//	Declare the functions with a default value for the SortMetrics pointer
-	template <typename T>
-	void sort(T* array, array_size_t size, SortMetrics *metrics = nullptr);
+	template <typename T, typename Metrics = SortMetrics>
+	void sort(T* array, array_size_t size, Metrics *metrics = nullptr);
 
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	void threeWayPartition(T* array, array_size_t start, array_size_t end,
-						   SortMetrics *metrics = nullptr);
+						   Metrics *metrics = nullptr);
 
 
 	/*	**********************************************************************	*/
@@ -75,8 +76,8 @@ namespace DutchFlagSort {
 	 * top level function that has same signature as other sort algorithms
 	 */
 
-	template <typename T>
-	void sort(T* array, array_size_t size, SortMetrics *metrics) {
+	template <typename T, typename Metrics>
+	void sort(T* array, array_size_t size, Metrics *metrics) {
 
 		//	These define the width of the whole array for threeWayPartitionToString()
 		global_start= 0;
@@ -94,9 +95,9 @@ namespace DutchFlagSort {
 	 * Three way partitioning function called recursively
 	 */
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	void threeWayPartition(T* array, array_size_t start, array_size_t end,
-						   SortMetrics *metrics) {
+						   Metrics *metrics) {
 
 		array_size_t size = end-start+1;
 
@@ -105,11 +106,9 @@ namespace DutchFlagSort {
 			return;
 
 
-		if (size == 2) {
-			if (metrics) metrics->compares++;
-			if (array[start] > array[end]) {
-				SortingUtilities::swap(array, start, end, metrics);
-			}
+		// a tiny array is sorted with a sorting network
+		if (size <= SortingNetworks::max_span_for_network<T>) {
+			SortingNetworks::sort(&array[start], size, metrics);
 			return;
 		}
 
@@ -10,6 +10,7 @@
 
 #include <iostream>
 #include <iomanip>
+#include <cstdint>
 
 #include "SortingDataTypes.h"
 #include "SortingUtilities.h"
@@ -21,6 +22,13 @@ namespace HeapSort {
 	constexpr int max_line_size = 120;
 	constexpr char tab_stop = ' ';
 
+	//	The number of children of each node in sortDAry().  The children
+	//	  of a node are next to each other, and the heap is half as deep
+	constexpr int d_ary_heap_arity = 4;
+
+	//	sortDAry() lines the groups of children up with cache lines
+	constexpr array_size_t cache_line_size = 64;
+
 	/*  **********************************************************	*/
 	/*						indices management macros				*/
 	/*  **********************************************************	*/
@@ -31,12 +39,21 @@ namespace HeapSort {
 	#pragma push_macro("parent")
 	#pragma push_macro("leftChild")
 	#pragma push_macro("rightChild")
+	#pragma push_macro("dAryFarthestNode")
+	#pragma push_macro("dAryParent")
+	#pragma push_macro("dAryFirstChild")
 
 	#define farthestNode(size) ((size)/2 - 1)
 	#define parent(i) 			(((i)-1)/2)
 	#define leftChild(i) 		((i)*2 + 1)
 	#define rightChild(i) 		((i)*2 + 2)
 
+	//	A heap where each node has 'd' children, and where the children of
+	//	  the root are the last 'd'-'o' of a group of 'd', see dAryOffset()
+	#define dAryFarthestNode(size, d, o)	dAryParent((size)-1, d, o)
+	#define dAryParent(i, d, o)			(((i)-1+(o))/(d))
+	#define dAryFirstChild(i, d, o)		((i) ? (i)*(d) + 1-(o) : 1)
+
 
 	/*	**********************************************************	*/
 	/*						function declarations					*/
@@ -44,23 +61,54 @@ namespace HeapSort {
 
 	// 	Declare the functions with default value of SortMetrics pointer
 	// 	Order the array as a max heap, with largest at 0
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	void heapify(T*array, array_size_t size,
-				 SortMetrics *metrics=nullptr);
+				 Metrics *metrics=nullptr);
 
 	//	Debugging - verify heapify & sinkNode produced a max heap
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	bool isMaxHeap(T*array, array_size_t size,
-				   SortMetrics *metrics=nullptr);
+				   Metrics *metrics=nullptr);
 
 	//	Debugging - Print out the array on multiple lines as a tree
 	template <typename T>
 	void printHeap(T*array, array_size_t size);
 
 	//	Sink an element below all larger elements
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	void sinkNode(array_size_t this_node, T*array, array_size_t size,
-				  SortMetrics *metrics=nullptr);
+				  Metrics *metrics=nullptr);
+
+	//	The same sort using Floyd's version of sinkNode(), which compares
+	//	  the children on the way down to a leaf and compares the element
+	//	  on the way back up
+	template <typename T, typename Metrics = SortMetrics>
+	void sortBottomUp(T* array, array_size_t size, Metrics *metrics=nullptr);
+
+	template <typename T, typename Metrics = SortMetrics>
+	void heapifyBottomUp(T*array, array_size_t size,
+						 Metrics *metrics=nullptr);
+
+	template <typename T, typename Metrics = SortMetrics>
+	void sinkNodeBottomUp(array_size_t this_node, T*array, array_size_t size,
+						  Metrics *metrics=nullptr);
+
+	//	The same sort using a heap where each node has 'D' children, and
+	//	  each group of children starts on a cache line boundary
+	template <int D, typename T, typename Metrics = SortMetrics>
+	void sortDAry(T* array, array_size_t size, Metrics *metrics=nullptr);
+
+	//	The number of elements the groups of children are shifted by
+	template <int D, typename T>
+	array_size_t dAryOffset(const T* array);
+
+	template <int D, typename T, typename Metrics = SortMetrics>
+	void heapifyDAry(T*array, array_size_t size, array_size_t offset,
+					 Metrics *metrics=nullptr);
+
+	template <int D, typename T, typename Metrics = SortMetrics>
+	void sinkNodeDAry(array_size_t this_node, T*array, array_size_t size,
+					  array_size_t offset, Metrics *metrics=nullptr);
 
 
 	/*	**********************************************************	*/
@@ -71,8 +119,8 @@ namespace HeapSort {
 	 * 	The sort algorithm using convention of other sort algorithm
 	 */
 
-	template <typename T>
-	void sort(T* array, array_size_t size, SortMetrics *metrics) {
+	template <typename T, typename Metrics = SortMetrics>
+	void sort(T* array, array_size_t size, Metrics *metrics) {
 
 		if (size <= 1)
 			return;
@@ -93,6 +141,42 @@ namespace HeapSort {
 		}
 	}
 
+	template <typename T, typename Metrics>
+	void sortBottomUp(T* array, array_size_t size, Metrics *metrics) {
+
+		if (size <= 1)
+			return;
+
+		if (SortingUtilities::isSorted(array, size, metrics))
+			return;
+
+		heapifyBottomUp(array, size, metrics);
+
+		for(array_size_t last_node = size-1; last_node != 0; last_node--) {
+			SortingUtilities::swap(array, last_node, 0, metrics);
+			sinkNodeBottomUp(0, array, last_node, metrics);
+		}
+	}
+
+	template <int D, typename T, typename Metrics>
+	void sortDAry(T* array, array_size_t size, Metrics *metrics) {
+
+		if (size <= 1)
+			return;
+
+		if (SortingUtilities::isSorted(array, size, metrics))
+			return;
+
+		array_size_t offset = dAryOffset<D>(array);
+
+		heapifyDAry<D>(array, size, offset, metrics);
+
+		for(array_size_t last_node = size-1; last_node != 0; last_node--) {
+			SortingUtilities::swap(array, last_node, 0, metrics);
+			sinkNodeDAry<D>(0, array, last_node, offset, metrics);
+		}
+	}
+
 	/* ****************************************	*/
 	/*				array management			*/
 	/* ****************************************	*/
@@ -102,8 +186,8 @@ namespace HeapSort {
 	 *   where each parent node is >= its children
 	 */
 
-	template <typename T>
-	void heapify(T*array, array_size_t size, SortMetrics *metrics) {
+	template <typename T, typename Metrics>
+	void heapify(T*array, array_size_t size, Metrics *metrics) {
 
 		// node will be pre-decremented before each sink
 		array_size_t node = farthestNode(size)+1;
@@ -114,15 +198,75 @@ namespace HeapSort {
 		} while (node != 0);
 	}
 
+	template <typename T, typename Metrics>
+	void heapifyBottomUp(T*array, array_size_t size, Metrics *metrics) {
+
+		// node will be pre-decremented before each sink
+		array_size_t node = farthestNode(size)+1;
+
+		do {
+			node--;
+			HeapSort::sinkNodeBottomUp(node, array, size, metrics);
+		} while (node != 0);
+	}
+
+	template <int D, typename T, typename Metrics>
+	void heapifyDAry(T*array, array_size_t size, array_size_t offset,
+					 Metrics *metrics) {
+
+		if (size <= 1)
+			return;
+
+		// node will be pre-decremented before each sink
+		array_size_t node = dAryFarthestNode(size, D, offset)+1;
+
+		do {
+			node--;
+			sinkNodeDAry<D>(node, array, size, offset, metrics);
+		} while (node != 0);
+	}
+
+
+	/*
+	 * 	The array is the caller's, so the heap can not be moved to start on
+	 * 	a cache line.  Instead the groups of children are counted from
+	 * 	'offset' elements before [1], as if that many elements were there:
+	 * 	the root has the last D-offset children of group 0, [1 : D-offset],
+	 * 	and the children of node i >= 1 are group i, [D*i+1-offset : D*i+D-offset].
+	 * 	'offset' is chosen so that group 0, and therefore every group,
+	 * 	starts on a boundary of the smaller of a cache line and a group.
+	 * 	When the elements do not fit the lines evenly it is 0, which is the
+	 * 	usual D-ary heap.
+	 */
+
+	template <int D, typename T>
+	array_size_t dAryOffset(const T* array) {
+
+		constexpr array_size_t element_size = sizeof(T);
+		constexpr array_size_t group_size	= D * element_size;
+		constexpr array_size_t alignment	= group_size < cache_line_size ?
+											  group_size : cache_line_size;
+
+		if (alignment % element_size != 0 || group_size % alignment != 0)
+			return 0;
+
+		array_size_t address = static_cast<array_size_t>(reinterpret_cast<uintptr_t>(array));
+		if (address % element_size != 0)
+			return 0;
+
+		// the number of elements from the boundary before [1] to [1]
+		return ((address + element_size) % alignment) / element_size;
+	}
+
 
 	/*
 	 * 	Move the element at 'this_node' down to a place where its parent
 	 *	  is >= to the element
 	 */
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	void sinkNode(array_size_t this_node, T*array, array_size_t size,
-				  SortMetrics *metrics) {
+				  Metrics *metrics) {
 
 		if (size <= 1)
 			return;
@@ -170,6 +314,125 @@ namespace HeapSort {
 	}
 
 
+	/*
+	 * 	sinkNode() compares the two children with each other and the larger
+	 * 	of them with the sinking element at every level.  In heap sort the
+	 * 	sinking element came from the bottom of the heap, so it nearly always
+	 * 	sinks most of the way back down, and the second compare is almost
+	 * 	always 'true'.
+	 *
+	 * 	Floyd's version follows the larger children all the way to a leaf,
+	 * 	one compare per level, then climbs back up the same path to the
+	 * 	first element that is >= the sinking element, which is usually only
+	 * 	a level or two.  The path from there up is shifted up one level and
+	 * 	the sinking element goes in the hole.
+	 */
+
+	template <typename T, typename Metrics>
+	void sinkNodeBottomUp(array_size_t this_node, T*array, array_size_t size,
+						  Metrics *metrics) {
+
+		if (size <= 1)
+			return;
+
+		array_size_t final_leaf	= size-1;
+		array_size_t node 		= this_node;
+
+		// follow the larger child down to a leaf
+		while (leftChild(node) <= final_leaf) {
+			array_size_t left_child 	= leftChild(node);
+			array_size_t right_child 	= rightChild(node);
+			node = left_child;
+			if (right_child <= final_leaf) {
+				if (metrics) metrics->compares++;
+				if (array[left_child] < array[right_child]) {
+					node = right_child;
+				}
+			}
+		}
+
+		// climb back up to the first element that is >= the sinking element
+		while (node != this_node) {
+			if (metrics) metrics->compares++;
+			if (!(array[node] < array[this_node]))
+				break;
+			node = parent(node);
+		}
+		if (node == this_node)
+			return;
+
+		// shift the path from 'node' up to 'this_node' up one level
+		if (metrics) metrics->assignments += 2;
+		T carried 	= array[node];
+		array[node] = array[this_node];
+		while (node != this_node) {
+			node = parent(node);
+			if (metrics) metrics->assignments += 2;
+			T displaced = array[node];
+			array[node] = carried;
+			carried 	= displaced;
+		}
+		return;
+	}
+
+	/*
+	 * 	sinkNodeBottomUp() for a heap where each node has D children, laid
+	 * 	out as dAryOffset() describes.  Finding the largest child takes
+	 * 	D-1 compares, so there is no separate compare with the sinking
+	 * 	element.
+	 */
+
+	template <int D, typename T, typename Metrics>
+	void sinkNodeDAry(array_size_t this_node, T*array, array_size_t size,
+					  array_size_t offset, Metrics *metrics) {
+
+		if (size <= 1)
+			return;
+
+		array_size_t final_leaf	= size-1;
+		array_size_t node 		= this_node;
+
+		// follow the largest child down to a leaf
+		while (dAryFirstChild(node, D, offset) <= final_leaf) {
+			array_size_t first_child = dAryFirstChild(node, D, offset);
+			array_size_t last_child  = dAryFirstChild(node+1, D, offset) - 1;
+			if (last_child > final_leaf) {
+				last_child = final_leaf;
+			}
+			node = first_child;
+			for (array_size_t child = first_child+1; child <= last_child; child++) {
+				if (metrics) metrics->compares++;
+				if (array[node] < array[child]) {
+					node = child;
+				}
+			}
+		}
+
+		// climb back up to the first element that is >= the sinking element
+		while (node != this_node) {
+			if (metrics) metrics->compares++;
+			if (!(array[node] < array[this_node]))
+				break;
+			node = dAryParent(node, D, offset);
+		}
+		if (node == this_node)
+			return;
+
+		// shift the path from 'node' up to 'this_node' up one level
+		if (metrics) metrics->assignments += 2;
+		T carried 	= array[node];
+		array[node] = array[this_node];
+		while (node != this_node) {
+			node = dAryParent(node, D, offset);
+			if (metrics) metrics->assignments += 2;
+			T displaced = array[node];
+			array[node] = carried;
+			carried 	= displaced;
+		}
+		return;
+	}
+
+
 	/* ****************************************	*/
 	/*				debugging resources			*/
 	/* ****************************************	*/
@@ -179,8 +442,8 @@ namespace HeapSort {
 	 * is >= its children
 	 */
 
-	template <typename T>
-	bool isMaxHeap(T*array, array_size_t size, SortMetrics *metrics) {
+	template <typename T, typename Metrics>
+	bool isMaxHeap(T*array, array_size_t size, Metrics *metrics) {
 
 		if (size <= 1)
 			return true;
@@ -256,5 +519,8 @@ namespace HeapSort {
 #pragma pop_macro("parent")
 #pragma pop_macro("leftChild")
 #pragma pop_macro("rightChild")
+#pragma pop_macro("dAryFarthestNode")
+#pragma pop_macro("dAryParent")
+#pragma pop_macro("dAryFirstChild")
 
 #endif
@@ -15,7 +15,8 @@
 #include "BlockSort.h"
 #include "SortingDataTypes.h"
 #include "SortingUtilities.h"
-#include "InsertionSort.h"
+#include "ScratchBuffer.h"
+#include "SimdSortingNetwork.h"
 
 #pragma push_macro("_dbg_ln")
 #pragma push_macro("_dbg")
@@ -44,6 +45,12 @@ namespace InPlaceMerge {
 	 *	If the array size is less than 32, use an insertion sort and return
 	 *
 	 *	The mergeInPlace is done using different algorithms
+	 *
+	 *	The caller can pass a ScratchBuffer as a cache, whose capacity is set
+	 *	  by the caller, e.g. 512 elements.  A merge whose smaller block fits
+	 *	  in the cache is done by copying that block into the cache and merging
+	 *	  it back, which is linear.  Larger merges are done in place.  Since
+	 *	  the blocks double with each pass, the early passes all fit.
 	 */
 
 	constexpr array_size_t initial_block_size = 16;
@@ -53,20 +60,46 @@ namespace InPlaceMerge {
 	/*	**************************************************************	*/
 
 	//	Declare the function with a default value for SortMetrics pointer
-	template <typename T>
-	void sort(T *array, array_size_t array_size, SortMetrics *metrics = nullptr);
+	template <typename T, typename Metrics = SortMetrics>
+	void sort(T *array, array_size_t array_size, Metrics *metrics = nullptr);
+
+	template <typename T, typename Metrics = SortMetrics>
+	void sort(T *array, array_size_t array_size, ScratchBuffer<T> &cache,
+			  Metrics *metrics = nullptr);
+
+	//	Merges with 'cache' when the smaller block is <= 'cache_size'
+	template <typename T, typename Metrics = SortMetrics>
+	void sortUsingCache(T *array, array_size_t array_size,
+						T *cache, array_size_t cache_size,
+						Metrics *metrics = nullptr);
 
 
 	/*	**************************************************************	*/
 	/*						function definitions						*/
 	/*	**************************************************************	*/
 
-	template <typename T>
-	void sort(T *array, array_size_t array_size, SortMetrics *metrics) {
+	template <typename T, typename Metrics>
+	void sort(T *array, array_size_t array_size, Metrics *metrics) {
+
+		sortUsingCache(array, array_size, static_cast<T*>(nullptr), 0, metrics);
+	}
+
+	template <typename T, typename Metrics>
+	void sort(T *array, array_size_t array_size, ScratchBuffer<T> &cache,
+			  Metrics *metrics) {
+
+		ScratchLease<T> lease(cache.capacity(), &cache);
+		sortUsingCache(array, array_size, lease.get(), cache.capacity(), metrics);
+	}
+
+	template <typename T, typename Metrics>
+	void sortUsingCache(T *array, array_size_t array_size,
+						T *cache, array_size_t cache_size,
+						Metrics *metrics) {
 
 		bool debug_verbose = false;
 
-		BlockOperations::MergeFunction<T> mergeBlocks;
+		BlockOperations::MergeFunction<T, Metrics> mergeBlocks;
 		BlockOperations::MergeStrategy merge_strategy =
 					BlockOperations::MergeStrategy::TABLE;
 		_dbg_ln("InPlaceMerge using " << merge_strategy);
@@ -79,7 +112,7 @@ namespace InPlaceMerge {
 
 		//	Small arrays can just be InsertionSorted and done
 		if (array_size < 2*initial_block_size) {
-			InsertionSort::sort(array, array_size, metrics);
+			SimdSortingNetwork::sort(array, array_size, metrics);
 			return;
 		}
 
@@ -93,8 +126,9 @@ namespace InPlaceMerge {
 			if (block_start + num_elements > array_size)
 				num_elements = array_size - block_start;
 			//	sort each block using a (simple) insertion sort
-				InsertionSort::sort(&array[block_start],
-									num_elements, metrics);
+			//	  or a sorting network for primitive types
+				SimdSortingNetwork::sort(&array[block_start],
+										 num_elements, metrics);
 			//	move over to the next block
 			block_start += block_size;
 		}
@@ -115,9 +149,17 @@ namespace InPlaceMerge {
 
 			//	move through each pair of blocks left to right merging them
 			while (block_2_start < array_size) {
-				mergeBlocks(array, 	block_1_start, block_1_end,
+				//	block_2 is never larger than block_1
+				if (block_2_end - block_2_start + 1 <= cache_size) {
+					BlockOperations::mergeTwoAdjacentBlocksUsingCache(array,
+									block_1_start, block_1_end,
 									block_2_start, block_2_end,
-									metrics);
+									cache, metrics);
+				} else {
+					mergeBlocks(array, 	block_1_start, block_1_end,
+										block_2_start, block_2_end,
+										metrics);
+				}
 				//	move the indices to the next pair of blocks
 				block_1_start = block_2_end + 1;
 				block_1_end	  = block_1_start + block_size - 1;
@@ -20,18 +20,18 @@ namespace InsertionSort {
 	/*	**************************************************************	*/
 
 	// Declare the function with default value for SortMetrics pointer
-	template <typename T>
-	void sort(T *array, array_size_t size, SortMetrics *metrics = nullptr);
+	template <typename T, typename Metrics = SortMetrics>
+	void sort(T *array, array_size_t size, Metrics *metrics = nullptr);
 
 
 	/*	**************************************************************	*/
 	/*						function definition							*/
 	/*	**************************************************************	*/
 
-	template <typename T>
-	void sort(T *array, array_size_t size, SortMetrics *metrics) {
+	template <typename T, typename Metrics>
+	void sort(T *array, array_size_t size, Metrics *metrics) {
 
-		for (array_size_t i = 1; i != size; i++)
+		for (array_size_t i = 1; i < size; i++)
 		{
 			// if the element to the left of 'i' is equal to
 			//	or of smaller than element[i], then 'i' is in
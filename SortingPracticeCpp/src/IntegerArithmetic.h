@@ -20,6 +20,10 @@
 template <typename T>
 T highestPowerOf2(T num);
 
+/*	returns the exponent of the largest integer power of 2 <= num, or -1 if num <= 0	*/
+template <typename T>
+int floorLog2(T num);
+
 
 /*	**************************************************************	*/
 /*	**************************************************************	*/
@@ -69,6 +73,28 @@ T highestPowerOf2(T num) {
 	return num - (num>>1);
 }
 
+/*
+ * template <typename T>
+ * int floorLog2(T num);
+ *
+ * 	returns the exponent of highestPowerOf2(num)
+ *
+ * 	  floorLog2(63) returns 5
+ * 	  floorLog2(64) returns 6
+ */
+
+template <typename T>
+int floorLog2(T num) {
+	if (num <= 0) {
+		return -1;
+	}
+	int exponent = 0;
+	while (num >>= 1) {
+		exponent++;
+	}
+	return exponent;
+}
+
 
 
 
@@ -0,0 +1,263 @@
+/*
+ * MemoryAccounting.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Joe Baker
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+#include "MemoryAccounting.h"
+
+namespace {
+
+	std::atomic<bool>		s_counting(false);
+	std::atomic<long long>	s_in_use(0);	// < 0 if the sort frees what it did not allocate
+	std::atomic<long long>	s_peak(0);
+	std::atomic<long>		s_num_allocations(0);
+	std::atomic<long long>	s_bytes_allocated(0);
+
+	void addInUse(long long bytes) {
+		long long in_use = s_in_use.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+		long long peak	 = s_peak.load(std::memory_order_relaxed);
+		while (in_use > peak &&
+			   !s_peak.compare_exchange_weak(peak, in_use, std::memory_order_relaxed)) {
+		}
+	}
+
+	/*	**********************************************************	*/
+	/*							stack sampling						*/
+	/*	**********************************************************	*/
+
+	constexpr uint64_t stack_pattern	 = 0x5AA5C33CF00F9669ULL;
+	constexpr size_t   stack_sample_words = stack_sample_bytes / sizeof(uint64_t);
+
+	//	The deepest word that was filled.  Kept as a number, it is the address
+	//	  of a local that has gone out of scope, on purpose
+	uintptr_t s_stack_low = 0;
+
+	//	The array is below the caller's frame once this returns, which is
+	//	  where the frames of whatever the caller calls next will be
+	__attribute__((noinline))
+	void fillStack(void) {
+		volatile uint64_t region[stack_sample_words];
+		for (size_t i = 0; i != stack_sample_words; i++) {
+			region[i] = stack_pattern;
+		}
+		s_stack_low = reinterpret_cast<uintptr_t>(region);
+	}
+
+	//	How far down from the top of the filled words the stack was used
+	__attribute__((noinline))
+	size_t stackUsed(void) {
+		volatile uint64_t *region = reinterpret_cast<volatile uint64_t*>(s_stack_low);
+		size_t i = 0;
+		while (i != stack_sample_words && region[i] == stack_pattern) {
+			i++;
+		}
+		return (stack_sample_words - i) * sizeof(uint64_t);
+	}
+
+	//	What start() & stop() use themselves, with nothing in between
+	size_t stackBaseline(void) {
+		static size_t baseline = [] {
+			fillStack();
+			return stackUsed();
+		}();
+		return baseline;
+	}
+}
+
+/*	**************************************************************	*/
+/*							MemoryAccounting						*/
+/*	**************************************************************	*/
+
+namespace MemoryAccounting {
+
+	void start(void) {
+		stackBaseline();
+		s_in_use			= 0;
+		s_peak				= 0;
+		s_num_allocations	= 0;
+		s_bytes_allocated	= 0;
+		fillStack();
+		s_counting			= true;
+	}
+
+	AuxMemory stop(void) {
+		s_counting = false;
+		size_t stack_used	= stackUsed();
+		size_t baseline		= stackBaseline();
+
+		AuxMemory retval;
+		retval.peak_bytes		= static_cast<size_t>(s_peak.load());
+		retval.stack_bytes		= stack_used > baseline ? stack_used - baseline : 0;
+		retval.num_allocations	= s_num_allocations.load();
+		retval.bytes_allocated	= static_cast<size_t>(s_bytes_allocated.load());
+		retval.num_sorts		= 1;
+		return retval;
+	}
+
+	bool isCounting(void) {
+		return s_counting.load(std::memory_order_relaxed);
+	}
+
+	void beginLease(size_t bytes) {
+		if (isCounting())
+			addInUse(static_cast<long long>(bytes));
+	}
+
+	void endLease(size_t bytes) {
+		if (isCounting())
+			addInUse(-static_cast<long long>(bytes));
+	}
+}
+
+/*	**************************************************************	*/
+/*					the counting operator new & delete				*/
+/*	**************************************************************	*/
+
+/*
+ * 	Only built with MEMORY_ACCOUNTING_HEAP defined, so that the sorts
+ * 	of other builds use the library's allocator & pay nothing for this.
+ *
+ * 	Every form of new & delete is replaced, plain, array, nothrow, sized
+ * 	& aligned, so that whichever form allocated the memory, the form
+ * 	that frees it finds the same layout.  Each allocation is preceded by
+ * 	a header that holds its size, so that delete can count it.  The
+ * 	header is as large as the alignment, so the memory after it is
+ * 	aligned as well as the memory before it.  Aligned new is always
+ * 	paired with aligned delete, which is given the same alignment, so
+ * 	delete can find the start of the header.
+ */
+
+#if defined(MEMORY_ACCOUNTING_HEAP)
+
+namespace {
+
+	constexpr size_t default_alignment = alignof(std::max_align_t);
+
+	size_t headerSize(size_t alignment) {
+		return alignment > default_alignment ? alignment : default_alignment;
+	}
+
+	void* allocate(size_t size, size_t alignment) noexcept {
+		size_t header = headerSize(alignment);
+		void *memory;
+		if (alignment <= default_alignment) {
+			memory = std::malloc(size + header);
+		} else {
+			// aligned_alloc() needs a multiple of the alignment
+			size_t total = (size + header + alignment-1) / alignment * alignment;
+			memory = std::aligned_alloc(alignment, total);
+		}
+		if (memory == nullptr) {
+			return nullptr;
+		}
+		char *pointer = static_cast<char*>(memory) + header;
+		reinterpret_cast<size_t*>(pointer)[-1] = size;
+		if (MemoryAccounting::isCounting()) {
+			s_num_allocations.fetch_add(1, std::memory_order_relaxed);
+			s_bytes_allocated.fetch_add(size, std::memory_order_relaxed);
+			addInUse(static_cast<long long>(size));
+		}
+		return pointer;
+	}
+
+	//	As the library's new does, calls the new handler until it gives up
+	void* allocateOrThrow(size_t size, size_t alignment) {
+		for (;;) {
+			void *pointer = allocate(size, alignment);
+			if (pointer != nullptr) {
+				return pointer;
+			}
+			std::new_handler handler = std::get_new_handler();
+			if (handler == nullptr) {
+				throw std::bad_alloc();
+			}
+			handler();
+		}
+	}
+
+	void deallocate(void *pointer, size_t alignment) noexcept {
+		if (pointer == nullptr) {
+			return;
+		}
+		if (MemoryAccounting::isCounting()) {
+			addInUse(-static_cast<long long>(static_cast<size_t*>(pointer)[-1]));
+		}
+		std::free(static_cast<char*>(pointer) - headerSize(alignment));
+	}
+
+	size_t alignmentOf(std::align_val_t alignment) {
+		return static_cast<size_t>(alignment);
+	}
+}
+
+void* operator new(std::size_t size) {
+	return allocateOrThrow(size, default_alignment);
+}
+void* operator new[](std::size_t size) {
+	return allocateOrThrow(size, default_alignment);
+}
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+	return allocate(size, default_alignment);
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+	return allocate(size, default_alignment);
+}
+void* operator new(std::size_t size, std::align_val_t align) {
+	return allocateOrThrow(size, alignmentOf(align));
+}
+void* operator new[](std::size_t size, std::align_val_t align) {
+	return allocateOrThrow(size, alignmentOf(align));
+}
+void* operator new(std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+	return allocate(size, alignmentOf(align));
+}
+void* operator new[](std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+	return allocate(size, alignmentOf(align));
+}
+
+void operator delete(void *pointer) noexcept {
+	deallocate(pointer, default_alignment);
+}
+void operator delete[](void *pointer) noexcept {
+	deallocate(pointer, default_alignment);
+}
+void operator delete(void *pointer, std::size_t) noexcept {
+	deallocate(pointer, default_alignment);
+}
+void operator delete[](void *pointer, std::size_t) noexcept {
+	deallocate(pointer, default_alignment);
+}
+void operator delete(void *pointer, const std::nothrow_t&) noexcept {
+	deallocate(pointer, default_alignment);
+}
+void operator delete[](void *pointer, const std::nothrow_t&) noexcept {
+	deallocate(pointer, default_alignment);
+}
+void operator delete(void *pointer, std::align_val_t align) noexcept {
+	deallocate(pointer, alignmentOf(align));
+}
+void operator delete[](void *pointer, std::align_val_t align) noexcept {
+	deallocate(pointer, alignmentOf(align));
+}
+void operator delete(void *pointer, std::size_t, std::align_val_t align) noexcept {
+	deallocate(pointer, alignmentOf(align));
+}
+void operator delete[](void *pointer, std::size_t, std::align_val_t align) noexcept {
+	deallocate(pointer, alignmentOf(align));
+}
+void operator delete(void *pointer, std::align_val_t align, const std::nothrow_t&) noexcept {
+	deallocate(pointer, alignmentOf(align));
+}
+void operator delete[](void *pointer, std::align_val_t align, const std::nothrow_t&) noexcept {
+	deallocate(pointer, alignmentOf(align));
+}
+
+#endif	// MEMORY_ACCOUNTING_HEAP
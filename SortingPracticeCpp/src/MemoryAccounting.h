@@ -0,0 +1,90 @@
+/*
+ * MemoryAccounting.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Joe Baker
+ */
+
+/*	The memory a sort uses beyond the array it sorts.
+ *
+ *	Heap  -	built with MEMORY_ACCOUNTING_HEAP defined, MemoryAccounting.cpp
+ *			  replaces the global operator new & delete with ones that
+ *			  count, while counting is on, every allocation & the bytes
+ *			  that are in use, on every thread.  This sees the new[] in
+ *			  BlockOperations' Queue, the BlockSort Descriptors & the
+ *			  std::vectors in CountingSort without changing them.  Other
+ *			  builds use the library's allocator & count no heap.
+ *	Arena -	a ScratchBuffer is kept between sorts, so after the first sort
+ *			  leasing it does not allocate.  ScratchLease reports the bytes
+ *			  it leases, which count as in use for as long as the lease.
+ *	Stack -	start() fills the stack below the caller with a pattern and
+ *			  stop() looks for the deepest word that is no longer the
+ *			  pattern.  Only the calling thread's stack is sampled, and
+ *			  only to a depth of stack_sample_bytes.
+ */
+
+#ifndef MEMORYACCOUNTING_H_
+#define MEMORYACCOUNTING_H_
+
+#include <cstddef>
+
+//	Sorts that use more stack than this report this much
+constexpr size_t stack_sample_bytes = 64 * 1024;
+
+//	The memory used by one or more sorts
+class AuxMemory {
+public:
+	size_t	peak_bytes;			// the most heap & arena in use at once, by any sort
+	size_t	stack_bytes;		// the deepest stack, of any sort
+	long	num_allocations;	// the total of all of the sorts
+	size_t	bytes_allocated;	// the total of all of the sorts
+	long	num_sorts;
+
+	AuxMemory() :	peak_bytes(0),
+					stack_bytes(0),
+					num_allocations(0),
+					bytes_allocated(0),
+					num_sorts(0) {}
+
+	double allocationsPerSort(void) const {
+		return num_sorts ? static_cast<double>(num_allocations) / num_sorts : 0.0;
+	}
+	double bytesAllocatedPerSort(void) const {
+		return num_sorts ? static_cast<double>(bytes_allocated) / num_sorts : 0.0;
+	}
+
+	//	peaks are the larger of the two, totals are added
+	AuxMemory& operator+=(const AuxMemory &other) {
+		if (other.peak_bytes > peak_bytes)
+			peak_bytes = other.peak_bytes;
+		if (other.stack_bytes > stack_bytes)
+			stack_bytes = other.stack_bytes;
+		num_allocations += other.num_allocations;
+		bytes_allocated += other.bytes_allocated;
+		num_sorts		+= other.num_sorts;
+		return *this;
+	}
+};
+
+namespace MemoryAccounting {
+
+	//	Whether allocations are counted, see above
+#if defined(MEMORY_ACCOUNTING_HEAP)
+	constexpr bool counts_heap = true;
+#else
+	constexpr bool counts_heap = false;
+#endif
+
+	//	Zeroes the counts, fills the stack & starts counting.  Call it from
+	//	  the same function, with the sort in between, as stop()
+	void start(void);
+	//	Stops counting & returns what was used since start()
+	AuxMemory stop(void);
+	bool isCounting(void);
+
+	//	The arena hook, for memory that was allocated before the sort
+	void beginLease(size_t bytes);
+	void endLease(size_t bytes);
+}
+
+#endif /* MEMORYACCOUNTING_H_ */
@@ -6,7 +6,9 @@
  *
  *      This is a bottom up version of merge sort that uses a
  *        single auxiliary array rather than allocating an
- *        auxiliary array each time two halves are merged
+ *        auxiliary array each time two halves are merged.
+ *        The auxiliary array comes from a ScratchBuffer, either
+ *        the caller's or the one kept for the calling thread
  */
 
 #ifndef MERGESORT_H_
@@ -14,9 +16,12 @@
 
 #include <iostream>
 #include <iomanip>
+#include <type_traits>
 
 #include "SortingDataTypes.h"
 #include "SortingUtilities.h"
+#include "WorkStealingPool.h"
+#include "ScratchBuffer.h"
 
 namespace MergeSort {
 
@@ -25,11 +30,111 @@ namespace MergeSort {
 	/*	**************************************************************	*/
 
 	// Declare function with default value for SortMetrics pointer
-	template <typename T>
-	void sort(T* array, array_size_t size, SortMetrics *metrics = nullptr);
+	template <typename T, typename Metrics = SortMetrics>
+	void sort(T* array, array_size_t size, Metrics *metrics = nullptr);
+
+	template <typename T, typename Metrics = SortMetrics>
+	void sort(T* array, array_size_t size, ScratchBuffer<T> &scratch,
+			  Metrics *metrics = nullptr);
+
+	template <typename T, typename Metrics = SortMetrics>
+	void sortObjectsBottomUp(T* array, array_size_t size, Metrics *metrics=nullptr);
+
+	template <typename T, typename Metrics = SortMetrics>
+	void sortObjectsBottomUp(T* array, array_size_t size, ScratchBuffer<T> &scratch,
+							 Metrics *metrics=nullptr);
+
+	//	Merges src[left:left_stop-1] and src[right:right_stop-1] into dst_array[dst_start:]
+	template <typename T, typename Metrics = SortMetrics>
+	void mergeRuns(T* src, array_size_t left, array_size_t left_stop,
+				   array_size_t right, array_size_t right_stop,
+				   T* dst_array, array_size_t dst_start, Metrics *metrics = nullptr);
+
+	//	mergeRuns() where each compare selects the element to copy & the
+	//	  index to advance, rather than branching
+	template <typename T, typename Metrics = SortMetrics>
+	void mergeRunsBranchless(T* src, array_size_t left, array_size_t left_stop,
+							 array_size_t right, array_size_t right_stop,
+							 T* dst_array, array_size_t dst_start, Metrics *metrics = nullptr);
+
+	//	mergeRunsBranchless() from both ends of the runs at once
+	template <typename T, typename Metrics = SortMetrics>
+	void mergeRunsBidirectional(T* src, array_size_t left, array_size_t left_stop,
+								array_size_t right, array_size_t right_stop,
+								T* dst_array, array_size_t dst_start, Metrics *metrics = nullptr);
+
+	//	The number of elements of the left run that are among the first
+	//	  'k' elements of the merge of the two runs
+	template <typename T, typename Metrics = SortMetrics>
+	array_size_t coRank(T* src, array_size_t left, array_size_t left_stop,
+						array_size_t right, array_size_t right_stop,
+						array_size_t k, Metrics *metrics = nullptr);
+
+	/*	The kernels below are for natural merge sorts such as TimSort,
+	 *	  which merge the runs that already exist in the array rather
+	 *	  than runs of 1, 2, 4, ...	*/
+
+	//	Returns the end of the run that starts at [start].  A strictly
+	//	  descending run is reversed, which keeps equal elements in order
+	template <typename T, typename Metrics = SortMetrics>
+	array_size_t findRun(T* array, array_size_t start, array_size_t stop,
+						 Metrics *metrics = nullptr);
+
+	//	Sorts [start:stop-1] where [start:sorted_stop-1] is already sorted
+	template <typename T, typename Metrics = SortMetrics>
+	void binaryInsertionSort(T* array, array_size_t start,
+							 array_size_t sorted_stop, array_size_t stop,
+							 Metrics *metrics = nullptr);
+
+	//	Index of the first element of [start:stop-1] that is >= 'key'
+	template <typename T, typename Metrics = SortMetrics>
+	array_size_t gallopFirst(T& key, T* array, array_size_t start, array_size_t stop,
+							 bool from_right, Metrics *metrics = nullptr);
+
+	//	Index of the first element of [start:stop-1] that is > 'key'
+	template <typename T, typename Metrics = SortMetrics>
+	array_size_t gallopLast(T& key, T* array, array_size_t start, array_size_t stop,
+							bool from_right, Metrics *metrics = nullptr);
 
+	//	Merges the adjacent runs [left:middle-1] and [middle:right_stop-1]
+	//	  in place.  'aux' must hold the smaller of the two runs
+	template <typename T, typename Metrics = SortMetrics>
+	void mergeAdjacentRuns(T* array, array_size_t left, array_size_t middle,
+						   array_size_t right_stop, T* aux,
+						   array_size_t &gallop_threshold, Metrics *metrics = nullptr);
+
+	template <typename T, typename Metrics = SortMetrics>
+	void mergeLow(T* array, array_size_t left, array_size_t middle,
+				  array_size_t right_stop, T* aux,
+				  array_size_t &gallop_threshold, Metrics *metrics = nullptr);
+
+	template <typename T, typename Metrics = SortMetrics>
+	void mergeHigh(T* array, array_size_t left, array_size_t middle,
+				   array_size_t right_stop, T* aux,
+				   array_size_t &gallop_threshold, Metrics *metrics = nullptr);
+
+	//	Sorts on WorkStealingPool::shared()
+	template <typename T, typename Metrics = SortMetrics>
+	void parallelSort(T* array, array_size_t size, Metrics *metrics = nullptr);
+
+	template <typename T, typename Metrics = SortMetrics>
+	void parallelSort(T* array, array_size_t size, WorkStealingPool &pool,
+					  Metrics *metrics = nullptr);
+
+	//	Elements that can be copied as bytes are merged without branching
+	//	  on the compares
 	template <typename T>
-	void sortObjectsBottomUp(T* array, array_size_t size, SortMetrics *metrics=nullptr);
+	constexpr bool merges_branchless = std::is_trivially_copyable<T>::value;
+
+	//	Arrays this small are sorted by a single thread
+	constexpr array_size_t parallel_grain_size = 1 << 14;
+
+	//	Each pass is split into about this many tasks per worker
+	constexpr int parallel_tasks_per_worker = 4;
+
+	//	After one run supplies this many elements in a row, the merge
+	//	  stops comparing one element at a time and gallops
+	constexpr array_size_t initial_gallop_threshold = SortingUtilities::gallop_threshold;
 
 
 	/*	**************************************************************	*/
@@ -40,33 +145,46 @@ namespace MergeSort {
 	 * 	Wrapper to match convention of other sort algorithms
 	 */
 
-	template <typename T>
-	void sort(T* array, array_size_t size, SortMetrics *metrics) {
+	template <typename T, typename Metrics>
+	void sort(T* array, array_size_t size, Metrics *metrics) {
 
 		return sortObjectsBottomUp(array, size, metrics);
 	}
 
+	template <typename T, typename Metrics>
+	void sort(T* array, array_size_t size, ScratchBuffer<T> &scratch,
+			  Metrics *metrics) {
+
+		return sortObjectsBottomUp(array, size, scratch, metrics);
+	}
+
 	/*
 	 * Sort objects without recursion which avoids allocating memory
 	 * every time the function is recursively called and the call overhead
 	 */
 
-	template <typename T>
-	void sortObjectsBottomUp(T*array, array_size_t size, SortMetrics *metrics) {
+	template <typename T, typename Metrics>
+	void sortObjectsBottomUp(T*array, array_size_t size, Metrics *metrics) {
+
+		return sortObjectsBottomUp(array, size,
+								   ScratchBuffer<T>::forThisThread(), metrics);
+	}
+
+	template <typename T, typename Metrics>
+	void sortObjectsBottomUp(T*array, array_size_t size, ScratchBuffer<T> &scratch,
+							 Metrics *metrics) {
 
 		if (size <= 1) {
 			return;
 		}
 
-		T aux[size];
+		ScratchLease<T> lease(size, &scratch);
+		T* aux = lease.get();
 		// this will be swapped before first use
 		T* src_array = aux;
 		T* dst_array = array;
 
-		array_size_t dst;
-		array_size_t left;
 		array_size_t left_stop;
-		array_size_t right;
 		array_size_t right_stop;
 
 		// for each successive size of sub-array
@@ -93,40 +211,553 @@ namespace MergeSort {
 					// terminate the right copy at end of array
 					right_stop = size;
 				}
-				dst 	= start;
-				left 	= start;
-				right 	= left_stop;
-
-				while (left != left_stop && right != right_stop) {
-					// compare values on left & right and move the lesser value
-					//	or give priority to the left value if they are equal
-					//	which guarantees stability
-					if (metrics) metrics->compares++;
-					if (src_array[left] <= src_array[right]) {
-						if (metrics) metrics->assignments++;
-						dst_array[dst++] = src_array[left++];
-					} else {
-						if (metrics) metrics->assignments++;
-						dst_array[dst++] = src_array[right++];
-					}
-				}
-				// The above loop terminated because either
-				// 	right == right_stop or left == left_stop, but not both.
-				// 	Finish copying the source half that was not completed.
-				while (left < left_stop) {
+				mergeRuns(src_array, start, left_stop, left_stop, right_stop,
+						  dst_array, start, metrics);
+			}
+		}
+
+		//	The array is sorted.  If it is stored in the aux buffer,
+		//	copied it over to the passed parameter
+		if (dst_array == aux) {
+			if (metrics) metrics->assignments += size;
+			for (array_size_t i = 0; i != size; i++) {
+				array[i] = aux[i];
+			}
+		}
+		return;
+	}
+
+	template <typename T, typename Metrics>
+	void mergeRuns(T* src, array_size_t left, array_size_t left_stop,
+				   array_size_t right, array_size_t right_stop,
+				   T* dst_array, array_size_t dst_start, Metrics *metrics) {
+
+		if constexpr (merges_branchless<T>) {
+			mergeRunsBidirectional(src, left, left_stop, right, right_stop,
+								   dst_array, dst_start, metrics);
+			return;
+		}
+
+		array_size_t dst = dst_start;
+
+		while (left != left_stop && right != right_stop) {
+			// compare values on left & right and move the lesser value
+			//	or give priority to the left value if they are equal
+			//	which guarantees stability
+			if (metrics) metrics->compares++;
+			if (src[left] <= src[right]) {
+				if (metrics) metrics->assignments++;
+				dst_array[dst++] = src[left++];
+			} else {
+				if (metrics) metrics->assignments++;
+				dst_array[dst++] = src[right++];
+			}
+		}
+		// The above loop terminated because either
+		// 	right == right_stop or left == left_stop, but not both.
+		// 	Finish copying the source half that was not completed.
+		while (left < left_stop) {
+			if (metrics) metrics->assignments++;
+			dst_array[dst++] = src[left++];
+		}
+		while (right < right_stop) {
+			if (metrics) metrics->assignments++;
+			dst_array[dst++] = src[right++];
+		}
+	}
+
+	/*
+	 * 	A compare whose outcome is random is a branch that the CPU guesses
+	 * 	wrong half the time.  Here the outcome is used as data instead:  it
+	 * 	picks which index to read, which compiles to a conditional move, and
+	 * 	is added to the indices.  Only the loop test branches.
+	 */
+
+	template <typename T, typename Metrics>
+	void mergeRunsBranchless(T* src, array_size_t left, array_size_t left_stop,
+							 array_size_t right, array_size_t right_stop,
+							 T* dst_array, array_size_t dst_start, Metrics *metrics) {
+
+		array_size_t dst = dst_start;
+
+		while (left != left_stop && right != right_stop) {
+			//	equal values take the left, which guarantees stability
+			bool take_right  = src[right] < src[left];
+			dst_array[dst++] = src[take_right ? right : left];
+			right			+= take_right;
+			left			+= !take_right;
+		}
+		if (metrics) {
+			metrics->compares 	 += dst - dst_start;
+			metrics->assignments += dst - dst_start
+									+ (left_stop - left) + (right_stop - right);
+		}
+		while (left != left_stop) {
+			dst_array[dst++] = src[left++];
+		}
+		while (right != right_stop) {
+			dst_array[dst++] = src[right++];
+		}
+	}
+
+	/*
+	 * 	If the shorter run has 'n' elements, the smallest 'n' elements of
+	 * 	the merge can be taken from the fronts of the runs and the largest
+	 * 	'n' from the backs without either end running out of a run, so the
+	 * 	loop needs no bounds checks.  The two ends don't depend on each other,
+	 * 	which lets the CPU work on both at once.  Equal values at the back
+	 * 	take the right, so the back half is as stable as the front.
+	 * 	Whatever is left in the middle, when the runs differ in size, is
+	 * 	merged by mergeRunsBranchless().
+	 */
+
+	template <typename T, typename Metrics>
+	void mergeRunsBidirectional(T* src, array_size_t left, array_size_t left_stop,
+								array_size_t right, array_size_t right_stop,
+								T* dst_array, array_size_t dst_start, Metrics *metrics) {
+
+		array_size_t left_size	= left_stop - left;
+		array_size_t right_size	= right_stop - right;
+		array_size_t steps		= left_size < right_size ? left_size : right_size;
+
+		array_size_t dst		= dst_start;
+		array_size_t dst_back	= dst_start + left_size + right_size - 1;
+		array_size_t left_back	= left_stop - 1;
+		array_size_t right_back	= right_stop - 1;
+
+		if (metrics) {
+			metrics->compares	 += 2*steps;
+			metrics->assignments += 2*steps;
+		}
+		for (array_size_t i = 0; i != steps; i++) {
+			bool take_right  		= src[right] < src[left];
+			dst_array[dst++] 		= src[take_right ? right : left];
+			right					+= take_right;
+			left					+= !take_right;
+
+			bool take_left			= src[right_back] < src[left_back];
+			dst_array[dst_back--]	= src[take_left ? left_back : right_back];
+			left_back				-= take_left;
+			right_back				-= !take_left;
+		}
+		mergeRunsBranchless(src, left, left_back+1, right, right_back+1,
+							dst_array, dst, metrics);
+	}
+
+	/*
+	 * 	Merge path co-ranking.  If 'i' elements of the left run and k-i
+	 * 	elements of the right run make up the first 'k' elements of the
+	 * 	merge, then the right run's last contribution goes before the left
+	 * 	run's next element:  right[k-i-1] < left[i].  That is the smallest
+	 * 	'i' for which it is true, so it is found with a binary search.
+	 * 	Equal elements go to the left run first, the same as mergeRuns()
+	 */
+
+	template <typename T, typename Metrics>
+	array_size_t coRank(T* src, array_size_t left, array_size_t left_stop,
+						array_size_t right, array_size_t right_stop,
+						array_size_t k, Metrics *metrics) {
+
+		array_size_t left_size	= left_stop - left;
+		array_size_t right_size	= right_stop - right;
+
+		array_size_t lo = k > right_size ? k - right_size : 0;
+		array_size_t hi = k < left_size  ? k : left_size;
+
+		while (lo < hi) {
+			array_size_t i = lo + (hi-lo)/2;
+			array_size_t j = k - i;
+			if (metrics) metrics->compares++;
+			if (src[right + j-1] < src[left + i]) {
+				hi = i;
+			} else {
+				lo = i+1;
+			}
+		}
+		return lo;
+	}
+
+	template <typename T, typename Metrics>
+	array_size_t findRun(T* array, array_size_t start, array_size_t stop,
+						 Metrics *metrics) {
+
+		array_size_t run_stop = start+1;
+		if (run_stop >= stop) {
+			return stop;
+		}
+
+		if (metrics) metrics->compares++;
+		if (array[run_stop] < array[start]) {
+			// strictly descending, so reversing it cannot reorder equal elements
+			run_stop++;
+			while (run_stop != stop) {
+				if (metrics) metrics->compares++;
+				if (!(array[run_stop] < array[run_stop-1]))
+					break;
+				run_stop++;
+			}
+			for (array_size_t i = start, j = run_stop-1; i < j; i++, j--) {
+				SortingUtilities::swap(array, i, j, metrics);
+			}
+		} else {
+			run_stop++;
+			while (run_stop != stop) {
+				if (metrics) metrics->compares++;
+				if (array[run_stop] < array[run_stop-1])
+					break;
+				run_stop++;
+			}
+		}
+		return run_stop;
+	}
+
+	/*
+	 * 	An insertion sort that finds where each element goes with a binary
+	 * 	search, which is log(n) compares per element instead of up to n.
+	 * 	The element goes after its equals, so the sort is stable.
+	 */
+
+	template <typename T, typename Metrics>
+	void binaryInsertionSort(T* array, array_size_t start,
+							 array_size_t sorted_stop, array_size_t stop,
+							 Metrics *metrics) {
+
+		if (sorted_stop == start) {
+			sorted_stop++;
+		}
+		for (array_size_t i = sorted_stop; i < stop; i++) {
+			array_size_t insert_at =
+				SortingUtilities::binarySearchLastElement(array, start, i-1, array[i], metrics);
+			if (insert_at == i) {
+				continue;
+			}
+			if (metrics) metrics->assignments += i - insert_at + 2;
+			T value = array[i];
+			for (array_size_t j = i; j != insert_at; j--) {
+				array[j] = array[j-1];
+			}
+			array[insert_at] = value;
+		}
+	}
+
+	/*
+	 * 	The runs are half-open, [start:stop-1], so these wrap
+	 * 	SortingUtilities::gallopingSearch, which takes the last index
+	 */
+
+	template <typename T, typename Metrics>
+	array_size_t gallopFirst(T& key, T* array, array_size_t start, array_size_t stop,
+							 bool from_right, Metrics *metrics) {
+		return SortingUtilities::gallopingSearch(array, start, stop-1, key,
+												 from_right, false, metrics);
+	}
+
+	template <typename T, typename Metrics>
+	array_size_t gallopLast(T& key, T* array, array_size_t start, array_size_t stop,
+							bool from_right, Metrics *metrics) {
+		return SortingUtilities::gallopingSearch(array, start, stop-1, key,
+												 from_right, true, metrics);
+	}
+
+	/*
+	 * 	The left run's elements that are <= the first element of the right
+	 * 	run, and the right run's elements that are >= the last element of
+	 * 	the left run, are already where they belong.  Only what is between
+	 * 	them is merged, and only the smaller of the two runs is copied out.
+	 */
+
+	template <typename T, typename Metrics>
+	void mergeAdjacentRuns(T* array, array_size_t left, array_size_t middle,
+						   array_size_t right_stop, T* aux,
+						   array_size_t &gallop_threshold, Metrics *metrics) {
+
+		left = gallopLast(array[middle], array, left, middle, false, metrics);
+		if (left == middle) {
+			return;
+		}
+		right_stop = gallopFirst(array[middle-1], array, middle, right_stop, true, metrics);
+		if (right_stop == middle) {
+			return;
+		}
+
+		if (middle - left <= right_stop - middle) {
+			mergeLow(array, left, middle, right_stop, aux, gallop_threshold, metrics);
+		} else {
+			mergeHigh(array, left, middle, right_stop, aux, gallop_threshold, metrics);
+		}
+	}
+
+	/*
+	 * 	Copies the left run into 'aux' and merges from the left end.
+	 *
+	 * 	Once one run has supplied 'gallop_threshold' elements in a row, the
+	 * 	merge gallops:  it searches each run for how many of its elements go
+	 * 	before the other run's next element and copies them all at once.
+	 * 	The threshold goes down while galloping pays and back up when it
+	 * 	stops paying, so random data goes back to one compare per element.
+	 */
+
+	template <typename T, typename Metrics>
+	void mergeLow(T* array, array_size_t left, array_size_t middle,
+				  array_size_t right_stop, T* aux,
+				  array_size_t &gallop_threshold, Metrics *metrics) {
+
+		array_size_t left_size = middle - left;
+		if (metrics) metrics->assignments += left_size;
+		for (array_size_t i = 0; i != left_size; i++) {
+			aux[i] = array[left+i];
+		}
+
+		array_size_t i 	 = 0;		// next element of the left run, in aux
+		array_size_t j 	 = middle;	// next element of the right run
+		array_size_t dst = left;
+
+		array_size_t left_wins	= 0;
+		array_size_t right_wins	= 0;
+		bool galloping 			= false;
+
+		while (i != left_size && j != right_stop) {
+			if (!galloping) {
+				// ties go to the left run, which keeps the merge stable
+				if (metrics) metrics->compares++;
+				if (array[j] < aux[i]) {
+					if (metrics) metrics->assignments++;
+					array[dst++] = array[j++];
+					right_wins++;
+					left_wins = 0;
+				} else {
 					if (metrics) metrics->assignments++;
-					dst_array[dst++] = src_array[left++];
+					array[dst++] = aux[i++];
+					left_wins++;
+					right_wins = 0;
 				}
-				while (right < right_stop) {
+				galloping = left_wins >= gallop_threshold || right_wins >= gallop_threshold;
+				continue;
+			}
+
+			// the left run's elements that go before array[j]
+			array_size_t k = gallopLast(array[j], aux, i, left_size, false, metrics);
+			left_wins = k - i;
+			if (metrics) metrics->assignments += left_wins;
+			while (i != k) {
+				array[dst++] = aux[i++];
+			}
+			if (i == left_size) {
+				break;
+			}
+
+			// the right run's elements that go before aux[i]
+			k = gallopFirst(aux[i], array, j, right_stop, false, metrics);
+			right_wins = k - j;
+			if (metrics) metrics->assignments += right_wins;
+			while (j != k) {
+				array[dst++] = array[j++];
+			}
+
+			if (left_wins >= initial_gallop_threshold ||
+				right_wins >= initial_gallop_threshold) {
+				if (gallop_threshold > 1) {
+					gallop_threshold--;
+				}
+			} else {
+				gallop_threshold += 2;
+				galloping 	= false;
+				left_wins 	= 0;
+				right_wins 	= 0;
+			}
+		}
+
+		// what is left of the right run is already in place
+		if (metrics) metrics->assignments += left_size - i;
+		while (i != left_size) {
+			array[dst++] = aux[i++];
+		}
+	}
+
+	/*
+	 * 	The mirror image of mergeLow():  copies the right run into 'aux' and
+	 * 	merges from the right end.  Ties go to the right run, because the
+	 * 	element that goes last is the one taken first.
+	 */
+
+	template <typename T, typename Metrics>
+	void mergeHigh(T* array, array_size_t left, array_size_t middle,
+				   array_size_t right_stop, T* aux,
+				   array_size_t &gallop_threshold, Metrics *metrics) {
+
+		array_size_t right_size = right_stop - middle;
+		if (metrics) metrics->assignments += right_size;
+		for (array_size_t j = 0; j != right_size; j++) {
+			aux[j] = array[middle+j];
+		}
+
+		array_size_t i 	 = middle-1;	 // last unmerged element of the left run
+		array_size_t j 	 = right_size-1; // last unmerged element of the right run, in aux
+		array_size_t dst = right_stop-1;
+
+		array_size_t left_wins	= 0;
+		array_size_t right_wins	= 0;
+		bool galloping 			= false;
+
+		while (i >= left && j >= 0) {
+			if (!galloping) {
+				if (metrics) metrics->compares++;
+				if (aux[j] < array[i]) {
+					if (metrics) metrics->assignments++;
+					array[dst--] = array[i--];
+					left_wins++;
+					right_wins = 0;
+				} else {
 					if (metrics) metrics->assignments++;
-					dst_array[dst++] = src_array[right++];
+					array[dst--] = aux[j--];
+					right_wins++;
+					left_wins = 0;
+				}
+				galloping = left_wins >= gallop_threshold || right_wins >= gallop_threshold;
+				continue;
+			}
+
+			// the left run's elements that go after aux[j]
+			array_size_t k = gallopLast(aux[j], array, left, i+1, true, metrics);
+			left_wins = i+1 - k;
+			if (metrics) metrics->assignments += left_wins;
+			while (i >= k) {
+				array[dst--] = array[i--];
+			}
+			if (i < left) {
+				break;
+			}
+
+			// the right run's elements that go after array[i]
+			k = gallopFirst(array[i], aux, 0, j+1, true, metrics);
+			right_wins = j+1 - k;
+			if (metrics) metrics->assignments += right_wins;
+			while (j >= k) {
+				array[dst--] = aux[j--];
+			}
+
+			if (left_wins >= initial_gallop_threshold ||
+				right_wins >= initial_gallop_threshold) {
+				if (gallop_threshold > 1) {
+					gallop_threshold--;
+				}
+			} else {
+				gallop_threshold += 2;
+				galloping 	= false;
+				left_wins 	= 0;
+				right_wins 	= 0;
+			}
+		}
+
+		// what is left of the left run is already in place
+		if (metrics) metrics->assignments += j+1;
+		while (j >= 0) {
+			array[dst--] = aux[j--];
+		}
+	}
+
+	template <typename T, typename Metrics>
+	void parallelSort(T* array, array_size_t size, Metrics *metrics) {
+		parallelSort(array, size, WorkStealingPool::shared(), metrics);
+	}
+
+	/*
+	 * 	The same passes as sortObjectsBottomUp(), with each pass split into
+	 * 	tasks that are run on the pool.  run() returns only when all of a
+	 * 	pass's tasks are done, which keeps the passes in order.
+	 *
+	 * 	While there are many pairs of runs, each task merges a group of
+	 * 	neighbouring pairs.  Once there are fewer pairs than tasks, each
+	 * 	merge is split by its output: a task writing output [k0:k1) uses
+	 * 	coRank() to find where its inputs start and stop.  Every element
+	 * 	lands where the serial merge puts it, so the result is identical.
+	 */
+
+	template <typename T, typename Metrics>
+	void parallelSort(T* array, array_size_t size, WorkStealingPool &pool,
+					  Metrics *metrics) {
+
+		if (size <= parallel_grain_size || pool.numWorkers() == 1) {
+			sortObjectsBottomUp(array, size, metrics);
+			return;
+		}
+
+		ScratchLease<T> aux(size);
+		// this will be swapped before first use
+		T* src_array = aux.get();
+		T* dst_array = array;
+
+		PerWorker<WorkerMetrics<Metrics>> worker_metrics(pool.numWorkers());
+		PerWorker<WorkerMetrics<Metrics>> *p_worker_metrics = metrics ? &worker_metrics : nullptr;
+
+		array_size_t num_tasks = pool.numWorkers() * parallel_tasks_per_worker;
+
+		for (array_size_t half = 1; half < size; half *= 2) {
+			// ping-pong
+			T* 		tmp = src_array;
+			src_array 	= dst_array;
+			dst_array 	= tmp;
+
+			array_size_t span 		= 2*half;
+			array_size_t num_pairs 	= (size + span - 1) / span;
+
+			//	the left & right runs of the pair that starts at 'start'
+			auto pair_bounds = [=](array_size_t start, array_size_t &left_stop,
+												   array_size_t &right_stop) {
+				left_stop 	= start+half < size ? start+half : size;
+				right_stop 	= start+span < size ? start+span : size;
+			};
+
+			pool.run([=, &pool](int root_id) {
+				if (num_pairs >= num_tasks) {
+					array_size_t pairs_per_task = (num_pairs + num_tasks - 1) / num_tasks;
+					for (array_size_t first = 0; first < num_pairs; first += pairs_per_task) {
+						array_size_t last = first + pairs_per_task < num_pairs ?
+											first + pairs_per_task : num_pairs;
+						pool.push(root_id, [=](int id) {
+							WorkerMetrics<Metrics> *m = p_worker_metrics ? &(*p_worker_metrics)[id] : nullptr;
+							for (array_size_t p = first; p != last; p++) {
+								array_size_t start = p*span, left_stop, right_stop;
+								pair_bounds(start, left_stop, right_stop);
+								mergeRuns(src_array, start, left_stop, left_stop, right_stop,
+										  dst_array, start, m);
+							}
+						});
+					}
+					return;
+				}
+				array_size_t parts_per_pair = (num_tasks + num_pairs - 1) / num_pairs;
+				for (array_size_t p = 0; p != num_pairs; p++) {
+					array_size_t start = p*span, left_stop, right_stop;
+					pair_bounds(start, left_stop, right_stop);
+					array_size_t pair_size = right_stop - start;
+					array_size_t part_size = (pair_size + parts_per_pair - 1) / parts_per_pair;
+					for (array_size_t k0 = 0; k0 < pair_size; k0 += part_size) {
+						array_size_t k1 = k0 + part_size < pair_size ? k0 + part_size : pair_size;
+						pool.push(root_id, [=](int id) {
+							WorkerMetrics<Metrics> *m = p_worker_metrics ? &(*p_worker_metrics)[id] : nullptr;
+							array_size_t i0 = coRank(src_array, start, left_stop,
+													 left_stop, right_stop, k0, m);
+							array_size_t i1 = coRank(src_array, start, left_stop,
+													 left_stop, right_stop, k1, m);
+							mergeRuns(src_array, start + i0, start + i1,
+									  left_stop + (k0-i0), left_stop + (k1-i1),
+									  dst_array, start + k0, m);
+						});
+					}
 				}
+			});
+		}
+
+		if (metrics) {
+			for (int i = 0; i != worker_metrics.size(); i++) {
+				*metrics += worker_metrics[i];
 			}
 		}
 
 		//	The array is sorted.  If it is stored in the aux buffer,
 		//	copied it over to the passed parameter
-		if (dst_array == aux) {
+		if (dst_array == aux.get()) {
 			if (metrics) metrics->assignments += size;
 			for (array_size_t i = 0; i != size; i++) {
 				array[i] = aux[i];
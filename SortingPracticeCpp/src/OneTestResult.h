@@ -30,6 +30,8 @@
 #include "InitialOrdering.h"
 #include "MessageList.h"
 #include "SortTestMetrics.h"
+#include "PerfCounters.h"
+#include "MemoryAccounting.h"
 #include "OStreamState.h"
 
 enum class TestResultMember{
@@ -88,6 +90,8 @@ public:
 	InitialOrdering 	m_ordering;
 	array_size_t 		m_size;
 	SortTestMetrics 	m_sort_metrics;
+	PerfCounts			m_perf_counts;	// empty unless the counters were read
+	AuxMemory			m_aux_memory;	// empty unless the memory was counted
 	SortFailureLog<T> 	*m_failure_log;
 	bool				m_is_stable;
 	bool				m_ignore;	// sortTest may not run a test if too big
@@ -121,6 +125,8 @@ public:
 			m_ordering 		= other.m_ordering;
 			m_size 			= other.m_size;
 			m_sort_metrics 	= other.m_sort_metrics;
+			m_perf_counts	= other.m_perf_counts;
+			m_aux_memory	= other.m_aux_memory;
 			m_is_stable		= other.m_is_stable;
 			m_ignore		= other.m_ignore;
 
@@ -147,6 +153,8 @@ public:
 			m_ordering 		= other.m_ordering;
 			m_size 			= other.m_size;
 			m_sort_metrics 	= other.m_sort_metrics;
+			m_perf_counts	= other.m_perf_counts;
+			m_aux_memory	= other.m_aux_memory;
 			m_is_stable		= other.m_is_stable;
 			m_ignore		= other.m_ignore;
 
@@ -184,6 +192,8 @@ public:
 			m_ordering 		= other.m_ordering;
 			m_size 			= other.m_size;
 			m_sort_metrics 	= other.m_sort_metrics;
+			m_perf_counts	= other.m_perf_counts;
+			m_aux_memory	= other.m_aux_memory;
 			m_is_stable		= other.m_is_stable;
 			m_ignore		= other.m_ignore;
 
@@ -223,6 +233,8 @@ public:
 			m_composition 		= other.m_composition;
 			m_ordering 			= other.m_ordering;
 			m_sort_metrics 		= other.m_sort_metrics;
+			m_perf_counts		= other.m_perf_counts;
+			m_aux_memory		= other.m_aux_memory;
 			m_is_stable			= other.m_is_stable;
 			m_ignore			= other.m_ignore;
 
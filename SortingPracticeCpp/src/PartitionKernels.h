@@ -0,0 +1,235 @@
+/*
+ * PartitionKernels.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Joe Baker
+ *
+ *      The partition step of the QuickSort based algorithms
+ */
+
+#ifndef PARTITIONKERNELS_H_
+#define PARTITIONKERNELS_H_
+
+#include <iostream>
+#include <iomanip>
+
+#include "SortingDataTypes.h"
+#include "SortingUtilities.h"
+
+/*
+ * 	Every kernel has the same contract:
+ * 		on entry, the pivot is in [start]
+ * 		on exit,  [start:end] is [ <= pivot : pivot : > pivot ]
+ * 		the return value is the pivot's final position
+ */
+
+namespace PartitionKernels {
+
+	enum class PartitionStrategy {
+		HOARE,
+		BLOCK,
+	};
+
+	template <typename T, typename Metrics = SortMetrics>
+	using PartitionFunction = array_size_t (*)(T* array,
+											   array_size_t start,
+											   array_size_t end,
+											   Metrics *metrics);
+
+	//	The number of elements classified by each pass of partitionBlock().
+	//	  Offsets into a block are stored as unsigned chars
+	constexpr array_size_t partition_block_size = 64;
+	static_assert(partition_block_size <= 256,
+				  "block offsets must fit in an unsigned char");
+
+	/*	**********************************************************	*/
+	/*						function declarations					*/
+	/*	**********************************************************	*/
+
+	template <typename T, typename Metrics = SortMetrics>
+	void assignPartitionFunction(PartitionFunction<T, Metrics>& function,
+								 PartitionStrategy strategy);
+
+	//	Scans in from both ends and swaps each out of place pair
+	template <typename T, typename Metrics = SortMetrics>
+	array_size_t partitionHoare(T* array, array_size_t start, array_size_t end,
+								Metrics *metrics = nullptr);
+
+	//	Classifies a block at each end without branching, then swaps in batches
+	template <typename T, typename Metrics = SortMetrics>
+	array_size_t partitionBlock(T* array, array_size_t start, array_size_t end,
+								Metrics *metrics = nullptr);
+
+
+	/*	**********************************************************	*/
+	/*						function definitions					*/
+	/*	**********************************************************	*/
+
+	template <typename T, typename Metrics>
+	void assignPartitionFunction(PartitionFunction<T, Metrics>& function,
+								 PartitionStrategy strategy) {
+		switch(strategy) {
+		case PartitionStrategy::BLOCK:
+			function = partitionBlock<T, Metrics>;
+			break;
+		case PartitionStrategy::HOARE:
+		default:
+			function = partitionHoare<T, Metrics>;
+			break;
+		}
+	}
+
+	/*
+	 * 	This is the partition loop that QuickSort and ProtectedQuickSort
+	 * 	have always used.  Each compare is followed by a branch that, on
+	 * 	random data, is mispredicted about half of the time.
+	 */
+
+	template <typename T, typename Metrics>
+	array_size_t partitionHoare(T* array, array_size_t start, array_size_t end,
+								Metrics *metrics) {
+
+		array_size_t pivot = start;
+		array_size_t upper = end;
+		array_size_t lower = start+1;
+
+		// from the right, find an array value that is <= pivot
+		// from the left,  find an array value that is > pivot
+		// exchange the two values
+		while (1) {
+			if (metrics) metrics->compares++;
+			// find an array value that is <= pivot
+			while (array[upper] > array[pivot]) {
+				upper--;
+				if (metrics) metrics->compares++;
+			}
+			// find an array value that is > pivot
+			//   or stop when lower == upper
+			//	 which means no value < pivot was found
+			while (lower < upper) {
+				if (metrics) metrics->compares++;
+				if (array[lower] > array[pivot])
+					break;
+				lower++;
+			}
+			//	if lower crossed upper, the partition is
+			//	 complete, so swap pivot with upper and exit
+			if (lower >= upper) {
+				SortingUtilities::swap(array, pivot, upper, metrics);
+				break;
+			}
+			// [upper] <= pivot
+			// [lower] >  pivot
+			//   and lower < upper
+			//   so exchange them
+			SortingUtilities::swap(array, lower, upper, metrics);
+			// at this point,
+			//	[upper] >  [pivot]
+			//	[lower] <= [pivot]
+			//	moving upper & lower is safe
+			lower++;
+			upper--;
+		}
+		return upper;
+	}
+
+	/*
+	 * 	BlockQuicksort partitioning.  A block of elements at the left end is
+	 * 	compared to the pivot and the offset of every element that belongs
+	 * 	on the right is recorded.  The offset is always written, but the
+	 * 	count only advances if the element is out of place, so there is no
+	 * 	branch on the result of the compare.  The same is done for a block at
+	 * 	the right end.  Then as many recorded pairs as possible are swapped.
+	 * 	A block whose out of place elements have all been swapped is retired
+	 * 	and the next block in from that end is classified.
+	 *
+	 * 	When fewer than two blocks of unclassified elements remain, the rest
+	 * 	of the range, including any partly swapped block, is partitioned with
+	 * 	an ordinary scan in from both ends.
+	 */
+
+	template <typename T, typename Metrics>
+	array_size_t partitionBlock(T* array, array_size_t start, array_size_t end,
+								Metrics *metrics) {
+
+		constexpr array_size_t block = partition_block_size;
+
+		if (metrics) metrics->assignments++;
+		const T pivot = array[start];
+
+		//	[start+1:lower-1] <= pivot, [upper+1:end] > pivot
+		array_size_t lower = start+1;
+		array_size_t upper = end;
+
+		unsigned char lower_offsets[block];
+		unsigned char upper_offsets[block];
+		array_size_t lower_count = 0, lower_first = 0;
+		array_size_t upper_count = 0, upper_first = 0;
+
+		while (upper - lower + 1 > 2*block) {
+			if (lower_count == 0) {
+				lower_first = 0;
+				for (array_size_t i = 0; i != block; i++) {
+					lower_offsets[lower_count] = static_cast<unsigned char>(i);
+					lower_count += (pivot < array[lower+i]);
+				}
+				if (metrics) metrics->compares += block;
+			}
+			if (upper_count == 0) {
+				upper_first = 0;
+				for (array_size_t i = 0; i != block; i++) {
+					upper_offsets[upper_count] = static_cast<unsigned char>(i);
+					upper_count += !(pivot < array[upper-i]);
+				}
+				if (metrics) metrics->compares += block;
+			}
+
+			array_size_t num_swaps = lower_count < upper_count ? lower_count : upper_count;
+			for (array_size_t i = 0; i != num_swaps; i++) {
+				SortingUtilities::swap(array,
+									   lower + lower_offsets[lower_first+i],
+									   upper - upper_offsets[upper_first+i],
+									   metrics);
+			}
+			lower_count -= num_swaps;	lower_first += num_swaps;
+			upper_count -= num_swaps;	upper_first += num_swaps;
+
+			if (lower_count == 0) {
+				lower += block;
+			}
+			if (upper_count == 0) {
+				upper -= block;
+			}
+		}
+
+		//	partition whatever is left between lower and upper
+		while (1) {
+			while (lower <= upper) {
+				if (metrics) metrics->compares++;
+				if (pivot < array[lower])
+					break;
+				lower++;
+			}
+			while (lower <= upper) {
+				if (metrics) metrics->compares++;
+				if (!(pivot < array[upper]))
+					break;
+				upper--;
+			}
+			if (lower > upper) {
+				break;
+			}
+			SortingUtilities::swap(array, lower, upper, metrics);
+			lower++;
+			upper--;
+		}
+
+		// upper is at the right-most element that is <= the pivot
+		if (upper != start) {
+			SortingUtilities::swap(array, start, upper, metrics);
+		}
+		return upper;
+	}
+}	// namespace PartitionKernels
+
+#endif /* PARTITIONKERNELS_H_ */
@@ -0,0 +1,319 @@
+/*
+ * PatternDefeatingQuickSort.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Joe Baker
+ */
+
+#ifndef PATTERNDEFEATINGQUICKSORT_H_
+#define PATTERNDEFEATINGQUICKSORT_H_
+
+#include <iostream>
+#include <iomanip>
+
+#include "SortingDataTypes.h"
+#include "SortingUtilities.h"
+#include "SimdSortingNetwork.h"
+#include "HeapSort.h"
+#include "IntegerArithmetic.h"
+
+//	This is ProtectedQuickSort with the pivot selection kept and four
+//	  protections added, each aimed at an input pattern that is common
+//	  in practice:
+//	1.	Already partitioned ranges
+//		If partitioning did not have to swap anything, the range may be
+//		nearly sorted.  Both sides are insertion sorted with a limit on
+//		the number of elements moved.  If neither side hits the limit, the
+//		range is done without any further partitioning.
+//	2.	Many identical keys
+//		The element to the left of a range that is not at the start of the
+//		array is <= every element in the range.  If it is equal to the pivot,
+//		every element equal to the pivot is partitioned to the left and
+//		needs no further sorting.  Runs of identical keys take linear time.
+//	3.	Badly unbalanced partitions
+//		When one side of a partition holds less than 1/8th of the range,
+//		a few elements on each side are swapped to break up the pattern
+//		that defeated the median of three.
+//	4.	Too many bad partitions
+//		After log2(n) unbalanced partitions, the range is heap sorted.
+//		This bounds the worst case at O(n log n).
+
+namespace PatternDefeatingQuickSort {
+
+	//	Below this size a range is insertion sorted
+	constexpr array_size_t max_size_to_cutoff_to_insertion_sort = 24;
+
+	//	The number of elements partialInsertionSort() may move before giving up
+	constexpr array_size_t partial_insertion_sort_limit = 8;
+
+	//	A partition is unbalanced if a side is smaller than span / this
+	constexpr array_size_t unbalanced_partition_divisor = 8;
+
+	/*	**********************************************************	*/
+	/*						function declarations					*/
+	/*	**********************************************************	*/
+
+	// Declare the functions with default parameter for SortMetrics*
+	template <typename T, typename Metrics = SortMetrics>
+	void sort(T* array, array_size_t size,
+			  Metrics *metrics = nullptr);
+
+	template <typename T, typename Metrics = SortMetrics>
+	void sortRange(T* array, array_size_t start, array_size_t end,
+				   int bad_partitions_allowed, bool is_leftmost,
+				   Metrics *metrics = nullptr);
+
+	//	Partitions into [ < pivot : pivot : >= pivot ] and returns the pivot's index
+	template <typename T, typename Metrics = SortMetrics>
+	array_size_t partitionRight(T* array, array_size_t start, array_size_t end,
+								bool &was_already_partitioned,
+								Metrics *metrics = nullptr);
+
+	//	Partitions into [ <= pivot : pivot : > pivot ] and returns the pivot's index
+	template <typename T, typename Metrics = SortMetrics>
+	array_size_t partitionLeft(T* array, array_size_t start, array_size_t end,
+							   Metrics *metrics = nullptr);
+
+	//	Returns false if more than partial_insertion_sort_limit elements were moved
+	template <typename T, typename Metrics = SortMetrics>
+	bool partialInsertionSort(T* array, array_size_t start, array_size_t end,
+							  Metrics *metrics = nullptr);
+
+
+	/*	**********************************************************	*/
+	/*						function definitions					*/
+	/*	**********************************************************	*/
+
+	template <typename T, typename Metrics>
+	void sort(T* array, array_size_t size, Metrics *metrics) {
+
+		if (size <= 1)
+			return;
+
+		sortRange(array, 0, size-1, floorLog2(size), true, metrics);
+		return;
+	}
+
+	/*
+	 * 	The smaller side of each partition is sorted by recursion and the
+	 * 	larger side by the loop, so the recursion is at most log2(size)
+	 * 	deep.  'is_leftmost' is false for any range that has an element to
+	 * 	its left, which is then known to be <= the range.
+	 */
+
+	template <typename T, typename Metrics>
+	void sortRange(T* array, array_size_t start, array_size_t end,
+				   int bad_partitions_allowed, bool is_leftmost,
+				   Metrics *metrics) {
+
+		while (end > start) {
+
+			array_size_t span = end-start+1;
+
+			// if the range is small enough, insertion sort it,
+			//  or use a sorting network for primitive types
+			if (span <= max_size_to_cutoff_to_insertion_sort) {
+				SimdSortingNetwork::sort(&array[start], span, metrics);
+				return;
+			}
+
+			// move the median of three values into the [start] slot
+			SortingUtilities::selectAndPositionPivot(array, start, end, metrics);
+
+			// if the element to the left equals the pivot, the pivot is the
+			//	smallest value in the range, so every element equal to it
+			//	can be put on the left and left there
+			if (!is_leftmost) {
+				if (metrics) metrics->compares++;
+				if (!(array[start-1] < array[start])) {
+					start = partitionLeft(array, start, end, metrics) + 1;
+					continue;
+				}
+			}
+
+			bool was_already_partitioned;
+			array_size_t pivot = partitionRight(array, start, end,
+												was_already_partitioned, metrics);
+
+			array_size_t left_span 	= pivot - start;
+			array_size_t right_span	= end - pivot;
+			array_size_t too_small	= span / unbalanced_partition_divisor;
+
+			if (left_span < too_small || right_span < too_small) {
+				if (--bad_partitions_allowed == 0) {
+					HeapSort::sort(&array[start], span, metrics);
+					return;
+				}
+				// break up the pattern by moving elements around on each side
+				if (left_span >= max_size_to_cutoff_to_insertion_sort) {
+					SortingUtilities::swap(array, start, start + left_span/4, metrics);
+					SortingUtilities::swap(array, pivot-1, pivot - left_span/4, metrics);
+				}
+				if (right_span >= max_size_to_cutoff_to_insertion_sort) {
+					SortingUtilities::swap(array, pivot+1, pivot+1 + right_span/4, metrics);
+					SortingUtilities::swap(array, end, end - right_span/4, metrics);
+				}
+			} else if (was_already_partitioned) {
+				// a range that needed no swaps is probably almost sorted
+				if (partialInsertionSort(array, start, pivot-1, metrics) &&
+					partialInsertionSort(array, pivot+1, end, metrics)) {
+					return;
+				}
+			}
+
+			if (left_span < right_span) {
+				if (pivot != start) {
+					sortRange(array, start, pivot-1, bad_partitions_allowed,
+							  is_leftmost, metrics);
+				}
+				start 		= pivot+1;
+				is_leftmost = false;
+			} else {
+				// the pivot is to the left of the right side
+				if (pivot != end) {
+					sortRange(array, pivot+1, end, bad_partitions_allowed,
+							  false, metrics);
+				}
+				end			= pivot-1;
+			}
+		}
+		return;
+	}
+
+	/*
+	 * 	Elements equal to the pivot go to the right.  The pivot is at
+	 * 	[start] on entry and is swapped into its final position before
+	 * 	returning.  If the first pair of scans meet without finding anything
+	 * 	to swap, the range was already partitioned.
+	 */
+
+	template <typename T, typename Metrics>
+	array_size_t partitionRight(T* array, array_size_t start, array_size_t end,
+								bool &was_already_partitioned,
+								Metrics *metrics) {
+
+		array_size_t lower = start+1;
+		array_size_t upper = end;
+
+		// find the first element >= pivot
+		while (lower <= end) {
+			if (metrics) metrics->compares++;
+			if (!(array[lower] < array[start]))
+				break;
+			lower++;
+		}
+		// find the last element < pivot
+		while (upper > start) {
+			if (metrics) metrics->compares++;
+			if (array[upper] < array[start])
+				break;
+			upper--;
+		}
+
+		was_already_partitioned = lower >= upper;
+
+		// the swapped elements stop each of the following scans
+		while (lower < upper) {
+			SortingUtilities::swap(array, lower, upper, metrics);
+			do {
+				lower++;
+				if (metrics) metrics->compares++;
+			} while (array[lower] < array[start]);
+			do {
+				upper--;
+				if (metrics) metrics->compares++;
+			} while (!(array[upper] < array[start]));
+		}
+
+		// upper is at the right-most element that is less than the pivot
+		if (upper != start) {
+			SortingUtilities::swap(array, start, upper, metrics);
+		}
+		return upper;
+	}
+
+	/*
+	 * 	This is the partition loop from ProtectedQuickSort.  Elements equal
+	 * 	to the pivot go to the left.
+	 */
+
+	template <typename T, typename Metrics>
+	array_size_t partitionLeft(T* array, array_size_t start, array_size_t end,
+							   Metrics *metrics) {
+
+		array_size_t pivot = start;
+		array_size_t upper = end;
+		array_size_t lower = start+1;
+
+		while (1) {
+			if (metrics) metrics->compares++;
+			while (array[upper] > array[pivot]) {
+				upper--;
+				if (metrics) metrics->compares++;
+			}
+			while (lower < upper) {
+				if (metrics) metrics->compares++;
+				if (array[lower] > array[pivot])
+					break;
+				lower++;
+			}
+			if (lower >= upper) {
+				// upper is at the right-most element that
+				//	is less than or equal to the pivot
+				if (upper != pivot) {
+					SortingUtilities::swap(array, pivot, upper, metrics);
+				}
+				break;
+			}
+			SortingUtilities::swap(array, lower, upper, metrics);
+			lower++;
+			upper--;
+		}
+		return upper;
+	}
+
+	/*
+	 * 	An insertion sort of [start:end] that stops once more than
+	 * 	partial_insertion_sort_limit elements have been moved.  Each element
+	 * 	is put back before stopping, so the range is always a permutation
+	 * 	of what it was on entry.
+	 */
+
+	template <typename T, typename Metrics>
+	bool partialInsertionSort(T* array, array_size_t start, array_size_t end,
+							  Metrics *metrics) {
+
+		array_size_t num_moved = 0;
+
+		for (array_size_t i = start+1; i <= end; i++) {
+			if (metrics) metrics->compares++;
+			if (!(array[i] < array[i-1]))
+				continue;
+
+			// make a copy of [i] and move the larger element to the right
+			if (metrics) metrics->assignments += 2;
+			T current_value = array[i];
+			array[i] = array[i-1];
+			array_size_t j = i-1;
+
+			while (j != start) {
+				if (metrics) metrics->compares++;
+				if (!(current_value < array[j-1]))
+					break;
+				if (metrics) metrics->assignments++;
+				array[j] = array[j-1];
+				j--;
+			}
+			if (metrics) metrics->assignments++;
+			array[j] = current_value;
+
+			num_moved += i-j;
+			if (num_moved > partial_insertion_sort_limit) {
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+#endif /* PATTERNDEFEATINGQUICKSORT_H_ */
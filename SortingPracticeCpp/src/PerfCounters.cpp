@@ -0,0 +1,214 @@
+/*
+ * PerfCounters.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Joe Baker
+ */
+
+#include "PerfCounters.h"
+
+#if defined(__linux__)
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/* ************************************************************	*/
+/*							PerfEvent							*/
+/* ************************************************************	*/
+
+std::string to_string(PerfEvent event) {
+	switch (event) {
+	case PerfEvent::CYCLES:			return "cycles";
+	case PerfEvent::INSTRUCTIONS:	return "instructions";
+	case PerfEvent::BRANCH_MISSES:	return "branch-misses";
+	case PerfEvent::L1D_MISSES:		return "L1D-misses";
+	case PerfEvent::LLC_MISSES:		return "LLC-misses";
+	case PerfEvent::DTLB_MISSES:	return "dTLB-misses";
+	default:						return "invalid PerfEvent";
+	}
+}
+
+/* ************************************************************	*/
+/*							PerfCounts							*/
+/* ************************************************************	*/
+
+PerfCounts::PerfCounts() : num_sorts(0) {
+	for (int i = 0; i != num_perf_events; i++) {
+		counts[i]		= 0;
+		is_counted[i]	= false;
+	}
+}
+
+bool PerfCounts::anyCounted(void) const {
+	for (int i = 0; i != num_perf_events; i++) {
+		if (is_counted[i])
+			return true;
+	}
+	return false;
+}
+
+bool PerfCounts::isCounted(PerfEvent event) const {
+	return is_counted[static_cast<int>(event)];
+}
+
+uint64_t PerfCounts::count(PerfEvent event) const {
+	return counts[static_cast<int>(event)];
+}
+
+double PerfCounts::instructionsPerCycle(void) const {
+	if (!isCounted(PerfEvent::CYCLES) || !isCounted(PerfEvent::INSTRUCTIONS) ||
+		count(PerfEvent::CYCLES) == 0) {
+		return 0.0;
+	}
+	return static_cast<double>(count(PerfEvent::INSTRUCTIONS)) / count(PerfEvent::CYCLES);
+}
+
+double PerfCounts::perElement(PerfEvent event, array_size_t size) const {
+	if (!isCounted(event) || num_sorts == 0 || size <= 0) {
+		return 0.0;
+	}
+	return static_cast<double>(count(event)) / num_sorts / size;
+}
+
+PerfCounts& PerfCounts::operator+=(const PerfCounts &other) {
+	//	the first sort decides which events are counted
+	for (int i = 0; i != num_perf_events; i++) {
+		counts[i]		+= other.counts[i];
+		is_counted[i]	 = num_sorts ? is_counted[i] && other.is_counted[i]
+								 	 : other.is_counted[i];
+	}
+	num_sorts += other.num_sorts;
+	return *this;
+}
+
+/* ************************************************************	*/
+/*							PerfCounters						*/
+/* ************************************************************	*/
+
+#if defined(__linux__)
+
+namespace {
+
+	constexpr uint64_t cacheMissConfig(uint64_t cache) {
+		return cache |
+			   (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+			   (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+	}
+
+	//	in the order of PerfEvent
+	struct PerfEventConfig {
+		uint32_t type;
+		uint64_t config;
+	};
+	constexpr PerfEventConfig perf_event_configs[num_perf_events] = {
+		{ PERF_TYPE_HARDWARE, 	PERF_COUNT_HW_CPU_CYCLES 			},
+		{ PERF_TYPE_HARDWARE, 	PERF_COUNT_HW_INSTRUCTIONS 			},
+		{ PERF_TYPE_HARDWARE, 	PERF_COUNT_HW_BRANCH_MISSES 		},
+		{ PERF_TYPE_HW_CACHE,	cacheMissConfig(PERF_COUNT_HW_CACHE_L1D)	},
+		{ PERF_TYPE_HW_CACHE,	cacheMissConfig(PERF_COUNT_HW_CACHE_LL)		},
+		{ PERF_TYPE_HW_CACHE,	cacheMissConfig(PERF_COUNT_HW_CACHE_DTLB)	},
+	};
+
+	int openPerfEvent(const PerfEventConfig &event) {
+		perf_event_attr attr;
+		memset(&attr, 0, sizeof(attr));
+		attr.size			= sizeof(attr);
+		attr.type			= event.type;
+		attr.config			= event.config;
+		attr.disabled		= 1;
+		attr.exclude_kernel	= 1;
+		attr.exclude_hv		= 1;
+		//	if there are more events than counters, the kernel takes turns
+		//	  & these say for how long each event was counted
+		attr.read_format	= PERF_FORMAT_TOTAL_TIME_ENABLED |
+							  PERF_FORMAT_TOTAL_TIME_RUNNING;
+		//	this thread, on any cpu, on its own
+		return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+	}
+}
+
+PerfCounters::PerfCounters() {
+	for (int i = 0; i != num_perf_events; i++) {
+		m_fds[i] = openPerfEvent(perf_event_configs[i]);
+	}
+}
+
+PerfCounters::~PerfCounters() {
+	for (int i = 0; i != num_perf_events; i++) {
+		if (m_fds[i] >= 0) {
+			close(m_fds[i]);
+		}
+	}
+}
+
+void PerfCounters::start(void) {
+	for (int i = 0; i != num_perf_events; i++) {
+		if (m_fds[i] >= 0) {
+			ioctl(m_fds[i], PERF_EVENT_IOC_RESET, 0);
+			ioctl(m_fds[i], PERF_EVENT_IOC_ENABLE, 0);
+		}
+	}
+}
+
+PerfCounts PerfCounters::stop(void) {
+	for (int i = 0; i != num_perf_events; i++) {
+		if (m_fds[i] >= 0) {
+			ioctl(m_fds[i], PERF_EVENT_IOC_DISABLE, 0);
+		}
+	}
+
+	PerfCounts retval;
+	retval.num_sorts = 1;
+	for (int i = 0; i != num_perf_events; i++) {
+		if (m_fds[i] < 0)
+			continue;
+		uint64_t values[3];		// count, time enabled, time running
+		if (read(m_fds[i], values, sizeof(values)) != sizeof(values))
+			continue;
+		//	an event that never got a counter was not counted
+		if (values[2] == 0)
+			continue;
+		if (values[2] < values[1]) {
+			values[0] = static_cast<uint64_t>(
+				static_cast<double>(values[0]) * values[1] / values[2]);
+		}
+		retval.counts[i]	 = values[0];
+		retval.is_counted[i] = true;
+	}
+	return retval;
+}
+
+#else
+
+PerfCounters::PerfCounters() {
+	for (int i = 0; i != num_perf_events; i++) {
+		m_fds[i] = -1;
+	}
+}
+
+PerfCounters::~PerfCounters() {}
+
+void PerfCounters::start(void) {}
+
+PerfCounts PerfCounters::stop(void) {
+	PerfCounts retval;
+	retval.num_sorts = 1;
+	return retval;
+}
+
+#endif
+
+bool PerfCounters::isAvailable(void) const {
+	for (int i = 0; i != num_perf_events; i++) {
+		if (m_fds[i] >= 0)
+			return true;
+	}
+	return false;
+}
+
+bool PerfCounters::isAvailable(PerfEvent event) const {
+	return m_fds[static_cast<int>(event)] >= 0;
+}
@@ -0,0 +1,86 @@
+/*
+ * PerfCounters.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Joe Baker
+ */
+
+/*	The processor's performance counters, read around a sort through
+ *	  Linux's perf_event_open().  Compares & assignments say how much work
+ *	  a sort does.  These say how well the machine does it:  instructions
+ *	  per cycle, and the cache, TLB & branch misses that stall it.
+ *
+ *	Each event is opened on its own, so an event the processor or the
+ *	  kernel does not support is left out without losing the others.  If
+ *	  perf is not allowed at all (perf_event_paranoid, a container, or not
+ *	  Linux), nothing is opened & isAvailable() is false.  The sorts run
+ *	  the same either way.
+ *
+ *	Only user space of the calling thread is counted, so the workers of
+ *	  a parallel sort are not.
+ */
+
+#ifndef PERFCOUNTERS_H_
+#define PERFCOUNTERS_H_
+
+#include <cstdint>
+#include <string>
+
+#include "SortingDataTypes.h"
+
+enum class PerfEvent {
+	CYCLES,
+	INSTRUCTIONS,
+	BRANCH_MISSES,
+	L1D_MISSES,
+	LLC_MISSES,
+	DTLB_MISSES,
+};
+constexpr int num_perf_events = 6;
+
+std::string to_string(PerfEvent event);
+
+//	The counts of one or more sorts
+class PerfCounts {
+public:
+	uint64_t	counts[num_perf_events];
+	bool		is_counted[num_perf_events];	// false if the event was not read
+	long		num_sorts;
+
+	PerfCounts();
+
+	bool		anyCounted(void) const;
+	bool		isCounted(PerfEvent event) const;
+	uint64_t	count(PerfEvent event) const;
+
+	//	instructions / cycles, 0 if either was not counted
+	double		instructionsPerCycle(void) const;
+	//	the count for one element of one sort, 0 if it was not counted
+	double		perElement(PerfEvent event, array_size_t size) const;
+
+	//	An event is counted in the total only if it was counted in both
+	PerfCounts& operator+=(const PerfCounts &other);
+};
+
+class PerfCounters {
+private:
+	int		m_fds[num_perf_events];
+
+public:
+	PerfCounters();
+	~PerfCounters();
+
+	PerfCounters(const PerfCounters&) = delete;
+	PerfCounters& operator=(const PerfCounters&) = delete;
+
+	//	true if at least one event can be read
+	bool		isAvailable(void) const;
+	bool		isAvailable(PerfEvent event) const;
+
+	//	Zeroes & starts the counters
+	void		start(void);
+	//	Stops the counters & returns what they counted since start()
+	PerfCounts	stop(void);
+};
+
+#endif /* PERFCOUNTERS_H_ */
@@ -14,7 +14,11 @@
 #include "SortingDataTypes.h"
 #include "SortingUtilities.h"
 #include "SimpleRandomizer.h"
-#include "InsertionSort.h"
+#include "SimdSortingNetwork.h"
+#include "HeapSort.h"
+#include "IntegerArithmetic.h"
+#include "PartitionKernels.h"
+#include "WorkStealingPool.h"
 
 //	There are two protections added to Quick Sort in this algorithm
 //	1.	Pre-randomize the array.
@@ -25,33 +29,85 @@
 //		This saves comparisons and moves on arrays that are almost sorted
 //		This reduces the number of comparisons slightly, but increases
 //		the number of moves by 35%
+//
+//	introSort() adds a third protection by bounding the recursion depth.
+//		Once a range has been partitioned 2*log2(n) levels deep, the
+//		pivots have been bad enough that the range is heap sorted instead.
+//		This guarantees O(n log n) compares and O(log n) stack depth
+//
+//	parallelSort() partitions on a WorkStealingPool.  The two ranges
+//		produced by each partition are pushed onto the pool as tasks, and
+//		ranges no larger than parallel_grain_size are sorted by introSort()
+//		on whichever worker picks them up
 
 namespace ProtectedQuickSort {
 
 	// Below a certain size, do an insertion sort rather
 	//	than all the overhead of partitioning
 
-	constexpr array_size_t max_size_to_cutoff_to_insertion_sort = 0;
+	constexpr array_size_t max_size_to_cutoff_to_insertion_sort = 16;
+
+	//	passed as the depth limit by sort(), which never falls back to HeapSort
+	constexpr int unlimited_depth = -1;
+
+	//	Ranges this small are not worth handing to another thread
+	constexpr array_size_t parallel_grain_size = 1 << 14;
+
 	/*	**********************************************************	*/
 	/*						function declarations					*/
 	/*	**********************************************************	*/
 
 	// Declare the functions with default parameter for SortMetrics*
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	void partitionArray(T* array, array_size_t start, array_size_t end,
-					    SortMetrics *metrics = nullptr);
+					    Metrics *metrics = nullptr,
+						int depth_limit = unlimited_depth,
+						PartitionKernels::PartitionFunction<T, Metrics> partition =
+							PartitionKernels::partitionHoare<T, Metrics>);
+
+	template <typename T, typename Metrics = SortMetrics>
+	void sort(T* array, array_size_t size,
+			  Metrics *metrics = nullptr);
+
+	template <typename T, typename Metrics = SortMetrics>
+	void introSort(T* array, array_size_t size,
+				   Metrics *metrics = nullptr);
 
-	template <typename T>
+	//	Sorts using the partition kernel selected by 'strategy'
+	template <typename T, typename Metrics = SortMetrics>
 	void sort(T* array, array_size_t size,
-			  SortMetrics *metrics = nullptr);
+			  PartitionKernels::PartitionStrategy strategy,
+			  Metrics *metrics = nullptr);
+
+	template <typename T, typename Metrics = SortMetrics>
+	void introSort(T* array, array_size_t size,
+				   PartitionKernels::PartitionStrategy strategy,
+				   Metrics *metrics = nullptr);
+
+	//	Sorts on WorkStealingPool::shared()
+	template <typename T, typename Metrics = SortMetrics>
+	void parallelSort(T* array, array_size_t size,
+					  Metrics *metrics = nullptr);
+
+	template <typename T, typename Metrics = SortMetrics>
+	void parallelSort(T* array, array_size_t size,
+					  WorkStealingPool &pool,
+					  Metrics *metrics = nullptr);
+
+	//	'worker_metrics' is nullptr if metrics are not being kept
+	template <typename T, typename Metrics>
+	void parallelPartitionArray(T* array, array_size_t start, array_size_t end,
+								int depth_limit,
+								WorkStealingPool &pool, int worker_id,
+								PerWorker<Metrics> *worker_metrics);
 
 
 	/*	**********************************************************	*/
 	/*						function definitions					*/
 	/*	**********************************************************	*/
 
-	template <typename T>
-	void sort(T* array, array_size_t size, SortMetrics *metrics) {
+	template <typename T, typename Metrics>
+	void sort(T* array, array_size_t size, Metrics *metrics) {
 
 		if (size <= 1)
 			return;
@@ -64,14 +120,145 @@ namespace ProtectedQuickSort {
 		return;
 	}
 
+	template <typename T, typename Metrics>
+	void introSort(T* array, array_size_t size, Metrics *metrics) {
+
+		if (size <= 1)
+			return;
+
+		if (!SortingUtilities::isSorted(array, size, metrics)) {
+			partitionArray(array, 0, size-1, metrics, 2*floorLog2(size));
+		}
+
+		return;
+	}
+
+	template <typename T, typename Metrics>
+	void sort(T* array, array_size_t size,
+			  PartitionKernels::PartitionStrategy strategy,
+			  Metrics *metrics) {
+
+		if (size <= 1)
+			return;
+
+		if (!SortingUtilities::isSorted(array, size, metrics)) {
+			PartitionKernels::PartitionFunction<T, Metrics> partition;
+			PartitionKernels::assignPartitionFunction<T, Metrics>(partition, strategy);
+			partitionArray(array, 0, size-1, metrics, unlimited_depth, partition);
+		}
+
+		return;
+	}
+
+	template <typename T, typename Metrics>
+	void introSort(T* array, array_size_t size,
+				   PartitionKernels::PartitionStrategy strategy,
+				   Metrics *metrics) {
+
+		if (size <= 1)
+			return;
+
+		if (!SortingUtilities::isSorted(array, size, metrics)) {
+			PartitionKernels::PartitionFunction<T, Metrics> partition;
+			PartitionKernels::assignPartitionFunction<T, Metrics>(partition, strategy);
+			partitionArray(array, 0, size-1, metrics, 2*floorLog2(size), partition);
+		}
+
+		return;
+	}
+
+
+	template <typename T, typename Metrics>
+	void parallelSort(T* array, array_size_t size, Metrics *metrics) {
+		parallelSort(array, size, WorkStealingPool::shared(), metrics);
+	}
+
+	/*
+	 * 	Each worker counts into its own WorkerMetrics, and the counts are
+	 * 	added to 'metrics' once the pool has finished, so the workers
+	 * 	never write to shared counters.
+	 */
+
+	template <typename T, typename Metrics>
+	void parallelSort(T* array, array_size_t size, WorkStealingPool &pool,
+					  Metrics *metrics) {
+
+		if (size <= parallel_grain_size || pool.numWorkers() == 1) {
+			introSort(array, size, metrics);
+			return;
+		}
+
+		if (SortingUtilities::isSorted(array, size, metrics)) {
+			return;
+		}
+
+		PerWorker<WorkerMetrics<Metrics>> worker_metrics(pool.numWorkers());
+		PerWorker<WorkerMetrics<Metrics>> *p_worker_metrics = metrics ? &worker_metrics : nullptr;
+
+		pool.run([=, &pool](int worker_id) {
+			parallelPartitionArray(array, 0, size-1, 2*floorLog2(size),
+								   pool, worker_id, p_worker_metrics);
+		});
+
+		if (metrics) {
+			for (int i = 0; i != worker_metrics.size(); i++) {
+				*metrics += worker_metrics[i];
+			}
+		}
+		return;
+	}
+
+	/*
+	 * 	The depth limit carries on into partitionArray(), so the whole
+	 * 	sort has the same O(n log n) bound as introSort()
+	 */
+
+	template <typename T, typename Metrics>
+	void parallelPartitionArray(T* array, array_size_t start, array_size_t end,
+								int depth_limit,
+								WorkStealingPool &pool, int worker_id,
+								PerWorker<Metrics> *worker_metrics) {
+
+		Metrics *metrics = worker_metrics ? &(*worker_metrics)[worker_id] : nullptr;
+
+		array_size_t span = end-start+1;
+		if (span <= parallel_grain_size || depth_limit == 0) {
+			partitionArray(array, start, end, metrics, depth_limit);
+			return;
+		}
+		depth_limit--;
+
+		// move the median of three values into the position slot
+		SortingUtilities::selectAndPositionPivot(array, start, end, metrics);
+
+		array_size_t upper = PartitionKernels::partitionHoare(array, start, end, metrics);
+
+		if (upper != start) {
+			pool.push(worker_id, [=, &pool](int id) {
+				parallelPartitionArray(array, start, upper-1, depth_limit,
+									   pool, id, worker_metrics);
+			});
+		}
+		if (upper != end) {
+			pool.push(worker_id, [=, &pool](int id) {
+				parallelPartitionArray(array, upper+1, end, depth_limit,
+									   pool, id, worker_metrics);
+			});
+		}
+		return;
+	}
 
 	/*
 	 * 	Partition array recursively into [ <= pivot : > pivot ]
+	 *
+	 * 	Each level of recursion decrements depth_limit.  When it reaches
+	 * 	zero, the range is heap sorted rather than partitioned again.
 	 */
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	void partitionArray(T* array, array_size_t start, array_size_t end,
-						SortMetrics *metrics) {
+						Metrics *metrics, int depth_limit,
+						PartitionKernels::PartitionFunction<T, Metrics> partition) {
 
 		if (end <= start) {
 			return;
@@ -88,46 +275,31 @@ namespace ProtectedQuickSort {
 			return;
 		}
 
-		// if array is small enough try insertion sort
+		// if array is small enough try insertion sort,
+		//  or a sorting network for primitive types
 		if (span <= max_size_to_cutoff_to_insertion_sort) {
-			InsertionSort::sort(&array[start], span, metrics);
+			SimdSortingNetwork::sort(&array[start], span, metrics);
+			return;
+		}
+
+		if (depth_limit == 0) {
+			HeapSort::sort(&array[start], span, metrics);
+			return;
+		}
+		if (depth_limit != unlimited_depth) {
+			depth_limit--;
 		}
 
 		// move the median of three values into the position slot
 		SortingUtilities::selectAndPositionPivot(array, start, end, metrics);
 
-		array_size_t pivot = start;
-		array_size_t upper = end;
-		array_size_t lower = start+1;
-
-		while (1) {
-			if (metrics) metrics->compares++;
-			while (array[upper] > array[pivot]) {
-				upper--;
-				if (metrics) metrics->compares++;
-			}
-			while (lower < upper) {
-				if (metrics) metrics->compares++;
-				if (array[lower] > array[pivot])
-					break;
-				lower++;
-			}
-			if (lower >= upper) {
-				// upper is at the right-most element that
-				//	is less than or equal to the pivot
-				SortingUtilities::swap(array, pivot, upper, metrics);
-				break;
-			}
-			SortingUtilities::swap(array, lower, upper, metrics);
-			lower++;
-			upper--;
-		}
+		array_size_t upper = partition(array, start, end, metrics);
 
 		if (upper != start) {
-			partitionArray(array, start, upper-1, metrics);
+			partitionArray(array, start, upper-1, metrics, depth_limit, partition);
 		}
 		if (upper != end) {
-			partitionArray(array, upper+1, end, metrics);
+			partitionArray(array, upper+1, end, metrics, depth_limit, partition);
 		}
 		return;
 	}
@@ -14,6 +14,8 @@
 #include "SortingDataTypes.h"
 #include "SortingUtilities.h"
 #include "SimpleRandomizer.h"
+#include "PartitionKernels.h"
+#include "SortingNetworks.h"
 
 #define VERBOSE_QUICK_SORT_MESSAGES false
 
@@ -31,20 +33,28 @@ namespace QuickSort {
 	/*	**********************************************************	*/
 
 	//	Declare the functions with default values for the SortMetrics pointer
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	void partitionArray(T* array, array_size_t start, array_size_t end,
-						SortMetrics *metrics = nullptr);
+						Metrics *metrics = nullptr,
+						PartitionKernels::PartitionFunction<T, Metrics> partition =
+							PartitionKernels::partitionHoare<T, Metrics>);
 
-	template <typename T>
-	void sort(T* array, array_size_t size, SortMetrics *metrics=nullptr);
+	template <typename T, typename Metrics = SortMetrics>
+	void sort(T* array, array_size_t size, Metrics *metrics=nullptr);
+
+	//	Sorts using the partition kernel selected by 'strategy'
+	template <typename T, typename Metrics = SortMetrics>
+	void sort(T* array, array_size_t size,
+			  PartitionKernels::PartitionStrategy strategy,
+			  Metrics *metrics=nullptr);
 
 
 	/*	**********************************************************	*/
 	/*						function definitions					*/
 	/*	**********************************************************	*/
 
-	template <typename T>
-	void sort(T* array, array_size_t size, SortMetrics *metrics) {
+	template <typename T, typename Metrics>
+	void sort(T* array, array_size_t size, Metrics *metrics) {
 
 		if (size <= 1)
 			return;
@@ -53,14 +63,29 @@ namespace QuickSort {
 		return;
 	}
 
+	template <typename T, typename Metrics>
+	void sort(T* array, array_size_t size,
+			  PartitionKernels::PartitionStrategy strategy,
+			  Metrics *metrics) {
+
+		if (size <= 1)
+			return;
+
+		PartitionKernels::PartitionFunction<T, Metrics> partition;
+		PartitionKernels::assignPartitionFunction<T>(partition, strategy);
+		partitionArray(array, 0, size-1, metrics, partition);
+		return;
+	}
+
 
 	/*
 	 * 	Partition array recursively into [ <= pivot : > pivot ]
 	 */
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	void partitionArray(T* array, array_size_t start, array_size_t end,
-						SortMetrics *metrics) {
+						Metrics *metrics,
+						PartitionKernels::PartitionFunction<T, Metrics> partition) {
 
 		if (end <= start) {
 			return;
@@ -68,64 +93,22 @@ namespace QuickSort {
 
 		array_size_t span = end - start + 1;
 
-		// an array with only two elements can be sorted simply
-		if (span == 2) {
-			if (metrics) metrics->compares++;
-			if (array[start] > array[end]) {
-				SortingUtilities::swap(array, start, end, metrics);
-			}
+		// a tiny array is sorted with a sorting network
+		if (span <= SortingNetworks::max_span_for_network<T>) {
+			SortingNetworks::sort(&array[start], span, metrics);
 			return;
 		}
 
-		array_size_t pivot = start;
-		array_size_t upper = end;
-		array_size_t lower = start+1;
-
-		// from the right, find an array value that is <= pivot
-		// from the left,  find an array value that is > pivot
-		// exchange the two values
-		while (1) {
-			if (metrics) metrics->compares++;
-			// find an array value that is <= pivot
-			while (array[upper] > array[pivot]) {
-				upper--;
-				if (metrics) metrics->compares++;
-			}
-			// find an array value that is > pivot
-			//   or stop when lower == upper
-			//	 which means no value < pivot was found
-			while (lower < upper) {
-				if (metrics) metrics->compares++;
-				if (array[lower] > array[pivot])
-					break;
-				lower++;
-			}
-			//	if lower crossed upper, the partition is
-			//	 complete, so swap pivot with upper and exit
-			if (lower >= upper) {
-				SortingUtilities::swap(array, pivot, upper, metrics);
-				break;
-			}
-			// [upper] <= pivot
-			// [lower] >  pivot
-			//   and lower < upper
-			//   so exchange them
-			SortingUtilities::swap(array, lower, upper, metrics);
-			// at this point,
-			//	[upper] >  [pivot]
-			//	[lower] <= [pivot]
-			//	moving upper & lower is safe
-			lower++;
-			upper--;
-		}
+		// the pivot is the first element of the span
+		array_size_t upper = partition(array, start, end, metrics);
 
 		// don't partition an array of only 1 element at 'start'
 		if (upper != start) {
-			partitionArray(array, start, upper-1, metrics);
+			partitionArray(array, start, upper-1, metrics, partition);
 		}
 		// don't partition an array of only 1 element at 'end'
 		if (upper != end) {
-			partitionArray(array, upper+1, end, metrics);
+			partitionArray(array, upper+1, end, metrics, partition);
 		}
 		return;
 	}
@@ -0,0 +1,248 @@
+/*
+ * RadixSort.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Joe Baker
+ *
+ *      This is a least-significant-digit radix sort.  Rather than
+ *        comparing elements, it makes one pass over the array per
+ *        digit of the key, scattering the elements back and forth
+ *        between the array and a single auxiliary array
+ */
+
+#ifndef RADIXSORT_H_
+#define RADIXSORT_H_
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "SortingDataTypes.h"
+#include "SortingUtilities.h"
+#include "ScratchBuffer.h"
+
+namespace RadixSort {
+
+	//	Each pass over the array sorts on one byte of the key
+	constexpr int bits_per_digit	= 8;
+	constexpr int digit_mask		= (1 << bits_per_digit) - 1;
+
+	/*	**************************************************************	*/
+	/*							key descriptions						*/
+	/*	**************************************************************	*/
+
+	/*
+	 * 	RadixKey<K> describes how a key of type K is broken into digits
+	 * 		num_buckets			the number of values a single digit can take
+	 * 		numDigits(key)		the number of digits needed to represent 'key'
+	 * 		digit(key, d, n)	the value of digit 'd' of 'key', where 0 is the
+	 * 							least significant digit and 'n' is the number
+	 * 							of digits in the widest key in the array
+	 *
+	 * 	Key types without a specialization are not radix sortable
+	 */
+
+	template <typename K, typename Enable = void>
+	struct RadixKey {
+		static constexpr bool is_sortable = false;
+	};
+
+	//	Signed integers have their sign bit flipped so that the unsigned
+	//	  representation of the key orders the same way the signed value does
+	template <typename K>
+	struct RadixKey<K, typename std::enable_if<std::is_integral<K>::value &&
+											   !std::is_same<K, bool>::value>::type> {
+		using unsigned_key_t = typename std::make_unsigned<K>::type;
+
+		static constexpr bool is_sortable 	= true;
+		static constexpr bool is_fixed_width= true;
+		static constexpr int  num_buckets 	= 1 << bits_per_digit;
+		static constexpr int  max_digits	= sizeof(K);
+
+		static int numDigits(const K&) {
+			return max_digits;
+		}
+
+		static int digit(const K& key, int d, int) {
+			unsigned_key_t u_key = static_cast<unsigned_key_t>(key);
+			if (std::is_signed<K>::value) {
+				u_key ^= unsigned_key_t(1) << (sizeof(K)*8 - 1);
+			}
+			return static_cast<int>((u_key >> (d*bits_per_digit)) & digit_mask);
+		}
+	};
+
+	//	Strings order character by character as unsigned chars, and a string
+	//	  goes before a longer string that starts with it.  Digit value 0 is
+	//	  reserved for 'past the end of this string' so that "AB" < "AB\0"
+	template <>
+	struct RadixKey<std::string> {
+		static constexpr bool is_sortable	= true;
+		static constexpr bool is_fixed_width= false;
+		static constexpr int  num_buckets	= (1 << bits_per_digit) + 1;
+
+		static int numDigits(const std::string& key) {
+			return static_cast<int>(key.size());
+		}
+
+		static int digit(const std::string& key, int d, int num_digits) {
+			size_t position = static_cast<size_t>(num_digits - 1 - d);
+			if (position >= key.size()) {
+				return 0;
+			}
+			return static_cast<unsigned char>(key[position]) + 1;
+		}
+	};
+
+	/*
+	 * 	RadixElement<T> extracts the key from an element of the array.
+	 * 	A SortingDataType<U> is sorted on its 'value' member
+	 */
+
+	template <typename T>
+	struct RadixElement {
+		using key_t = T;
+		static const T& key(const T& element) {	return element;	}
+	};
+
+	template <typename U>
+	struct RadixElement<SortingDataType<U>> {
+		using key_t = U;
+		static const U& key(const SortingDataType<U>& element) { return element.value; }
+	};
+
+	//	Used by testOneAlgorithm() to decide if RADIX_SORT can be run on 'T'
+	template <typename T>
+	constexpr bool is_radix_sortable = RadixKey<typename RadixElement<T>::key_t>::is_sortable;
+
+
+	/*	**************************************************************	*/
+	/*						function declarations						*/
+	/*	**************************************************************	*/
+
+	// Declare function with default value for SortMetrics pointer
+	template <typename T, typename Metrics = SortMetrics>
+	void sort(T* array, array_size_t size, Metrics *metrics = nullptr);
+
+	//	The number of digits in the widest key in the array
+	template <typename T>
+	int numDigits(T* array, array_size_t size);
+
+
+	/*	**************************************************************	*/
+	/*						function definitions						*/
+	/*	**************************************************************	*/
+
+	template <typename T>
+	int numDigits(T* array, array_size_t size) {
+
+		using Element 	= RadixElement<T>;
+		using Key		= RadixKey<typename Element::key_t>;
+
+		if constexpr (Key::is_fixed_width) {
+			return Key::max_digits;
+		} else {
+			int max_digits = 0;
+			for (array_size_t i = 0; i != size; i++) {
+				int digits = Key::numDigits(Element::key(array[i]));
+				if (digits > max_digits) {
+					max_digits = digits;
+				}
+			}
+			return max_digits;
+		}
+	}
+
+	/*
+	 * 	All of the digit histograms are gathered in a single read of the
+	 * 	array.  Then, from the least significant digit to the most, each
+	 * 	digit's histogram is turned into the starting position of each bucket
+	 * 	and the elements are scattered, in order, into their bucket.  Because
+	 * 	the scatter preserves the order of elements with identical digits,
+	 * 	each pass keeps the ordering produced by the previous passes, which
+	 * 	also makes the sort stable.
+	 *
+	 * 	If every key has the same value for a digit, the pass would just copy
+	 * 	the array, so that pass is skipped.  Small integers stored in a wide
+	 * 	type only pay for the digits that actually vary.
+	 */
+
+	template <typename T, typename Metrics>
+	void sort(T* array, array_size_t size, Metrics *metrics) {
+
+		using Element 	= RadixElement<T>;
+		using Key		= RadixKey<typename Element::key_t>;
+		static_assert(Key::is_sortable,
+					  "RadixSort requires keys that reduce to integers or strings");
+
+		if (size <= 1) {
+			return;
+		}
+
+		int num_digits = numDigits(array, size);
+		if (num_digits == 0) {
+			return;
+		}
+
+		constexpr int num_buckets = Key::num_buckets;
+
+		//	counts[d*num_buckets + b] is the number of keys with value 'b' in digit 'd'
+		std::vector<array_size_t> counts(num_digits * num_buckets, 0);
+		for (array_size_t i = 0; i != size; i++) {
+			const auto& key = Element::key(array[i]);
+			for (int d = 0; d != num_digits; d++) {
+				counts[d*num_buckets + Key::digit(key, d, num_digits)]++;
+			}
+		}
+
+		ScratchLease<T> aux(size);
+		array_size_t bucket_start[num_buckets];
+
+		// this will be swapped after the first scatter
+		T* src_array = array;
+		T* dst_array = aux.get();
+
+		for (int d = 0; d != num_digits; d++) {
+			array_size_t *digit_counts = &counts[d*num_buckets];
+
+			//	If every key has the same value in this digit, skip the pass
+			int first_digit = Key::digit(Element::key(src_array[0]), d, num_digits);
+			if (digit_counts[first_digit] == size) {
+				continue;
+			}
+
+			//	convert the counts into the position of each bucket's first element
+			array_size_t position = 0;
+			for (int b = 0; b != num_buckets; b++) {
+				bucket_start[b] = position;
+				position 	   += digit_counts[b];
+			}
+
+			//	scatter, left to right, to preserve the previous passes' ordering
+			for (array_size_t i = 0; i != size; i++) {
+				int b = Key::digit(Element::key(src_array[i]), d, num_digits);
+				dst_array[bucket_start[b]++] = src_array[i];
+			}
+			if (metrics) metrics->assignments += size;
+
+			// ping-pong
+			T* tmp 		= src_array;
+			src_array 	= dst_array;
+			dst_array 	= tmp;
+		}
+
+		//	The array is sorted.  If it is stored in the aux buffer,
+		//	copy it over to the passed parameter
+		if (src_array != array) {
+			if (metrics) metrics->assignments += size;
+			for (array_size_t i = 0; i != size; i++) {
+				array[i] = src_array[i];
+			}
+		}
+		return;
+	}
+}	// namespace RadixSort
+
+#endif /* RADIXSORT_H_ */
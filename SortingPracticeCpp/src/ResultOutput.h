@@ -35,6 +35,28 @@ constexpr int slash_separator_strlen 				= 3;
 constexpr int average_compares_strlen 	 			= 7;
 constexpr int average_assignments_strlen 			= 8;
 constexpr int stability_string_strlen				= 4;
+constexpr char min_time_string[]					= "min";
+constexpr char median_time_string[]					= "med";
+constexpr char mean_time_string[]					= "mean";
+constexpr char p90_time_string[]					= "p90";
+constexpr char p99_time_string[]					= "p99";
+constexpr int time_string_strlen					= 4;	// the longest label
+constexpr int num_time_columns						= 5;
+constexpr char ipc_string[]							= "IPC";
+constexpr char branch_misses_string[]				= "brm/e";	// per element
+constexpr char l1d_misses_string[]					= "L1D/e";
+constexpr char llc_misses_string[]					= "LLC/e";
+constexpr char dtlb_misses_string[]					= "TLB/e";
+constexpr int perf_string_strlen					= 5;	// the longest label
+constexpr int num_perf_columns						= 5;
+constexpr int perf_precision						= 2;
+constexpr char peak_aux_bytes_string[]				= "aux B";
+constexpr char stack_bytes_string[]					= "stack B";
+constexpr char allocations_string[]					= "allocs";
+constexpr char bytes_allocated_string[]				= "alloc B";
+constexpr int memory_string_strlen					= 7;	// the longest label
+constexpr int num_memory_columns					= 4;
+constexpr int allocations_precision					= 1;
 
 /*	**************************************************************************	*/
 /*			Information about how the output table should be structured			*/
@@ -408,6 +430,133 @@ int getMaxDigitsAssignments(OneTestResult<T>** result, int num_tests) {
 }
 
 
+/*					getMaxDigitsTimes()					*/
+
+template <typename T>
+int getMaxDigitsTimes(OneTestResult<T>** result, int num_tests) {
+
+	int max_digits = 1;
+
+	//	the longest of the times that are printed is the p99 time
+	uint64_t max_time = 0;
+	for (int i = 0; i != num_tests; i++) {
+		uint64_t this_time =
+			static_cast<uint64_t>(result[i]->m_sort_metrics.percentileTime(99) + 0.5);
+		if (this_time > max_time) {
+			max_time = this_time;
+		}
+	}
+
+	while (max_time >= 10) {
+		max_digits++;
+		max_time /= 10;
+	}
+
+	return max_digits;
+}
+
+
+/*					anyPerfCounts()						*/
+
+//	true if the performance counters were read for any of the results
+template <typename T>
+bool anyPerfCounts(OneTestResult<T>** result, int num_tests) {
+
+	for (int i = 0; i != num_tests; i++) {
+		if (result[i]->m_perf_counts.anyCounted()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+//	IPC, then the misses per element, in the order of the perf columns
+inline void perfColumns(const PerfCounts &counts, array_size_t size,
+						double values[num_perf_columns]) {
+	values[0] = counts.instructionsPerCycle();
+	values[1] = counts.perElement(PerfEvent::BRANCH_MISSES, size);
+	values[2] = counts.perElement(PerfEvent::L1D_MISSES, size);
+	values[3] = counts.perElement(PerfEvent::LLC_MISSES, size);
+	values[4] = counts.perElement(PerfEvent::DTLB_MISSES, size);
+}
+
+
+/*					getMaxDigitsPerf()					*/
+
+//	The width of the widest of the perf columns, including the fraction
+template <typename T>
+int getMaxDigitsPerf(OneTestResult<T>** result, int num_tests) {
+
+	int max_digits = 1;
+
+	uint64_t max_value = 0;
+	for (int i = 0; i != num_tests; i++) {
+		double values[num_perf_columns];
+		perfColumns(result[i]->m_perf_counts, result[i]->m_size, values);
+		for (double value : values) {
+			uint64_t this_value = static_cast<uint64_t>(value + 0.5);
+			if (this_value > max_value) {
+				max_value = this_value;
+			}
+		}
+	}
+
+	while (max_value >= 10) {
+		max_digits++;
+		max_value /= 10;
+	}
+
+	return max_digits + 1 + perf_precision;
+}
+
+
+/*					anyAuxMemory()						*/
+
+//	true if the memory was counted for any of the results
+template <typename T>
+bool anyAuxMemory(OneTestResult<T>** result, int num_tests) {
+
+	for (int i = 0; i != num_tests; i++) {
+		if (result[i]->m_aux_memory.num_sorts != 0) {
+			return true;
+		}
+	}
+	return false;
+}
+
+
+/*					getMaxDigitsMemory()				*/
+
+//	The width of the widest of the memory columns
+template <typename T>
+int getMaxDigitsMemory(OneTestResult<T>** result, int num_tests) {
+
+	int max_digits = 1;
+
+	uint64_t max_value = 0;
+	for (int i = 0; i != num_tests; i++) {
+		const AuxMemory &memory = result[i]->m_aux_memory;
+		for (double value : { static_cast<double>(memory.peak_bytes),
+							  static_cast<double>(memory.stack_bytes),
+							  memory.allocationsPerSort(),
+							  memory.bytesAllocatedPerSort() }) {
+			uint64_t this_value = static_cast<uint64_t>(value + 0.5);
+			if (this_value > max_value) {
+				max_value = this_value;
+			}
+		}
+	}
+
+	while (max_value >= 10) {
+		max_digits++;
+		max_value /= 10;
+	}
+
+	//	the allocations have a fraction
+	return max_digits + 1 + allocations_precision;
+}
+
+
 /*					getMaxDigitsArraySize()			*/
 
 template <typename T>
@@ -672,9 +821,11 @@ void printRowPreamble_ColumnsSize_CellsAverages(OneTestResult<T>** results,
 	int max_digits_compares 	= getMaxDigitsCompares(results, num_test_results);
 	int max_digits_moves 		= getMaxDigitsAssignments(results, num_test_results);
 	int max_digits_repetitions	= getMaxDigitsRepetitions(results, num_test_results);
+	int max_digits_times		= getMaxDigitsTimes(results, num_test_results);
 	int compares_strlen		= max_digits_compares;
 	int assignments_strlen	= max_digits_moves;
 	int repetitions_strlen	= max_digits_repetitions;
+	int times_strlen		= max_digits_times;
 
 	//	Ensure compares occupy at least the width of the "avg cmp" string
 	if (compares_strlen < average_compares_strlen) {
@@ -684,6 +835,29 @@ void printRowPreamble_ColumnsSize_CellsAverages(OneTestResult<T>** results,
 	if (assignments_strlen < average_assignments_strlen) {
 		assignments_strlen = average_assignments_strlen;
 	}
+	//	Ensure each time occupies at least the width of its label
+	if (times_strlen < time_string_strlen) {
+		times_strlen = time_string_strlen;
+	}
+	int times_header_width = num_time_columns * (times_strlen + space_separator_strlen);
+
+	//	The performance counters get columns only if they were read
+	bool print_perf = anyPerfCounts(results, num_test_results);
+	int perf_strlen = getMaxDigitsPerf(results, num_test_results);
+	if (perf_strlen < perf_string_strlen) {
+		perf_strlen = perf_string_strlen;
+	}
+	int perf_header_width =
+		print_perf ? num_perf_columns * (perf_strlen + space_separator_strlen) : 0;
+
+	//	The memory gets columns only if it was counted
+	bool print_memory = anyAuxMemory(results, num_test_results);
+	int memory_strlen = getMaxDigitsMemory(results, num_test_results);
+	if (memory_strlen < memory_string_strlen) {
+		memory_strlen = memory_string_strlen;
+	}
+	int memory_header_width =
+		print_memory ? num_memory_columns * (memory_strlen + space_separator_strlen) : 0;
 
 	int array_size_header_width =
 			max_algorithm_strlen 	+ space_separator_strlen +
@@ -699,7 +873,14 @@ void printRowPreamble_ColumnsSize_CellsAverages(OneTestResult<T>** results,
 		std::cout << std::setw(compares_strlen + slash_separator_strlen)
 				  << size_data.sizes[i];
 		std::cout << std::setw(assignments_strlen + stability_string_strlen)
-				  << " " << space_separator << space_separator;
+				  << " " << space_separator << space_separator
+				  << std::setw(times_header_width) << " ";
+		if (print_perf) {
+			std::cout << std::setw(perf_header_width) << " ";
+		}
+		if (print_memory) {
+			std::cout << std::setw(memory_header_width) << " ";
+		}
 	}
 	std::cout << std::endl;
 
@@ -715,6 +896,25 @@ void printRowPreamble_ColumnsSize_CellsAverages(OneTestResult<T>** results,
 				  << space_separator
 				  << std::setw(stability_string_strlen) << std::left << stability_string
 				  << space_separator;
+		for (const char *label : { min_time_string, median_time_string, mean_time_string,
+								   p90_time_string, p99_time_string }) {
+			std::cout << std::setw(times_strlen) << std::right << label
+					  << space_separator;
+		}
+		if (print_perf) {
+			for (const char *label : { ipc_string, branch_misses_string, l1d_misses_string,
+									   llc_misses_string, dtlb_misses_string }) {
+				std::cout << std::setw(perf_strlen) << std::right << label
+						  << space_separator;
+			}
+		}
+		if (print_memory) {
+			for (const char *label : { peak_aux_bytes_string, stack_bytes_string,
+									   allocations_string, bytes_allocated_string }) {
+				std::cout << std::setw(memory_strlen) << std::right << label
+						  << space_separator;
+			}
+		}
 	}
 	std::cout << std::endl;
 
@@ -791,6 +991,51 @@ void printRowPreamble_ColumnsSize_CellsAverages(OneTestResult<T>** results,
 				  << stabilityToString(results[i]->m_composition.composition,
 						  	  	  	   results[i]->m_is_stable)
 				  << space_separator;
+		const SortTestMetrics &metrics = results[i]->m_sort_metrics;
+		for (double time : { metrics.minTime(), metrics.medianTime(), metrics.meanTime(),
+							 metrics.percentileTime(90), metrics.percentileTime(99) }) {
+			std::cout << std::setw(times_strlen) << std::right
+					  << metrics.time_str(time)
+					  << space_separator;
+		}
+		if (print_perf) {
+			const PerfCounts &counts = results[i]->m_perf_counts;
+			PerfEvent perf_events[num_perf_columns] = {
+				PerfEvent::INSTRUCTIONS, PerfEvent::BRANCH_MISSES, PerfEvent::L1D_MISSES,
+				PerfEvent::LLC_MISSES, PerfEvent::DTLB_MISSES };
+			double values[num_perf_columns];
+			perfColumns(counts, results[i]->m_size, values);
+			for (int column = 0; column != num_perf_columns; column++) {
+				std::cout << std::setw(perf_strlen) << std::right;
+				//	IPC needs the cycles as well as the instructions
+				if (counts.isCounted(perf_events[column]) &&
+					(column != 0 || counts.isCounted(PerfEvent::CYCLES))) {
+					std::cout << std::fixed << std::setprecision(perf_precision)
+							  << values[column];
+				} else {
+					std::cout << "-";
+				}
+				std::cout << space_separator;
+			}
+		}
+		if (print_memory) {
+			const AuxMemory &memory = results[i]->m_aux_memory;
+			std::cout << std::setw(memory_strlen) << std::right
+					  << memory.peak_bytes << space_separator
+					  << std::setw(memory_strlen) << std::right
+					  << memory.stack_bytes << space_separator;
+			if (MemoryAccounting::counts_heap) {
+				std::cout << std::setw(memory_strlen) << std::right << std::fixed
+						  << std::setprecision(allocations_precision)
+						  << memory.allocationsPerSort() << space_separator
+						  << std::setw(memory_strlen) << std::right
+						  << std::setprecision(0)
+						  << memory.bytesAllocatedPerSort() << space_separator;
+			} else {
+				std::cout << std::setw(memory_strlen) << std::right << "-" << space_separator
+						  << std::setw(memory_strlen) << std::right << "-" << space_separator;
+			}
+		}
 	}
 	std::cout << std::endl << std::endl;
 
@@ -813,6 +1058,20 @@ void printTestResults(OneTestResult<T> **results, int num_test_results,
 			  << test_result_table_header << std::endl;
 	CompareFunction<T> isLess = assignCompareFunction<T>(structure);
 	sortResultsArray(results, num_test_results, isLess);
+	if (num_test_results > 0) {
+		std::cout << "Times are per sort, in "
+				  << results[0]->m_sort_metrics.timeUnits() << std::endl;
+	}
+	if (anyPerfCounts(results, num_test_results)) {
+		std::cout << "IPC is instructions per cycle, x/e is x per element per sort,"
+				  << " '-' was not counted" << std::endl;
+	}
+	if (anyAuxMemory(results, num_test_results)) {
+		std::cout << "aux B & stack B are the most any sort used,"
+				  << " allocs & alloc B are per sort."
+				  << " The stack is sampled to " << stack_sample_bytes << " bytes"
+				  << std::endl;
+	}
 	printRowPreamble_ColumnsSize_CellsAverages(results, num_test_results, structure);
 }
 
@@ -0,0 +1,346 @@
+/*
+ * Rotation.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Joe Baker
+ */
+
+#ifndef ROTATION_H_
+#define ROTATION_H_
+
+#include <numeric>
+
+#include "SortingDataTypes.h"
+#include "SortTestMetrics.h"
+
+/*
+ * 	Kernels that exchange two adjacent spans of an array, moving
+ * 	[start:start+left_size-1] to after the 'right_size' elements that
+ * 	follow it.  Every rotation in the block sorts & merges is done by
+ * 	rotate(), which picks a kernel by the sizes of the spans and of T:
+ *
+ * 	REVERSAL	  -	reverses each span, then the whole.  n swaps, or 3n
+ * 					assignments.  This is the kernel the sorts used to use.
+ * 	BLOCK_SWAP	  -	Gries & Mills: swaps the smaller span with the end of
+ * 					the larger one, which leaves a smaller rotation.
+ * 					Also n swaps, but it only walks forward.
+ * 	JUGGLING	  -	follows the gcd(n, left_size) cycles of the rotation,
+ * 					moving each element once, n + gcd assignments, but
+ * 					it jumps around the array.
+ * 	BUFFERED	  -	copies the smaller span into a buffer, slides the
+ * 					larger span over & copies the buffer back, n + the
+ * 					smaller span assignments, all sequential
+ * 	TRINITY		  -	the three reversals of REVERSAL done at once, by
+ * 					walking four indices toward each other (conjoined
+ * 					reversal, from quadsort).  2n assignments, all
+ * 					sequential, so it is the fastest for small elements.
+ */
+
+namespace Rotation {
+
+	enum class RotationKernel {
+		REVERSAL,
+		BLOCK_SWAP,
+		JUGGLING,
+		BUFFERED,
+		TRINITY,
+	};
+
+	//	The buffer on the stack that rotate() uses for small rotations
+	constexpr array_size_t rotation_buffer_bytes = 256;
+
+	//	Elements larger than this are not copied into the stack buffer
+	constexpr size_t max_buffered_element_size = 16;
+
+	template <typename T>
+	constexpr array_size_t rotation_buffer_size =
+		sizeof(T) <= max_buffered_element_size ? rotation_buffer_bytes / sizeof(T) : 0;
+
+	//	Elements at least this large are rotated by juggling, which moves
+	//	  each of them once
+	constexpr size_t min_juggled_element_size = 32;
+
+	/*	**********************************************************	*/
+	/*						function declarations					*/
+	/*	**********************************************************	*/
+
+	//	Picks a kernel by the size of the spans and sizeof(T)
+	template <typename T, typename Metrics = SortMetrics>
+	void rotate(T* array, array_size_t start,
+				array_size_t left_size, array_size_t right_size,
+				Metrics *metrics = nullptr);
+
+	template <typename T, typename Metrics = SortMetrics>
+	void rotate(T* array, array_size_t start,
+				array_size_t left_size, array_size_t right_size,
+				RotationKernel kernel, Metrics *metrics = nullptr);
+
+	template <typename T, typename Metrics = SortMetrics>
+	void rotateByReversal(T* array, array_size_t start,
+						  array_size_t left_size, array_size_t right_size,
+						  Metrics *metrics = nullptr);
+
+	template <typename T, typename Metrics = SortMetrics>
+	void rotateByBlockSwap(T* array, array_size_t start,
+						   array_size_t left_size, array_size_t right_size,
+						   Metrics *metrics = nullptr);
+
+	template <typename T, typename Metrics = SortMetrics>
+	void rotateByJuggling(T* array, array_size_t start,
+						  array_size_t left_size, array_size_t right_size,
+						  Metrics *metrics = nullptr);
+
+	//	The smaller of the two spans must fit in 'buffer'
+	template <typename T, typename Metrics = SortMetrics>
+	void rotateWithBuffer(T* array, array_size_t start,
+						  array_size_t left_size, array_size_t right_size,
+						  T* buffer, Metrics *metrics = nullptr);
+
+	template <typename T, typename Metrics = SortMetrics>
+	void rotateByTrinity(T* array, array_size_t start,
+						 array_size_t left_size, array_size_t right_size,
+						 Metrics *metrics = nullptr);
+
+	//	Swaps [a:a+size-1] with [b:b+size-1]
+	template <typename T, typename Metrics = SortMetrics>
+	void swapSpans(T* array, array_size_t a, array_size_t b, array_size_t size,
+				   Metrics *metrics = nullptr);
+
+
+	/*	**********************************************************	*/
+	/*						function definitions					*/
+	/*	**********************************************************	*/
+
+	template <typename T, typename Metrics>
+	void rotate(T* array, array_size_t start,
+				array_size_t left_size, array_size_t right_size,
+				Metrics *metrics) {
+
+		if (left_size <= 0 || right_size <= 0)
+			return;
+
+		if (left_size == right_size) {
+			swapSpans(array, start, start + left_size, left_size, metrics);
+			return;
+		}
+
+		if constexpr (rotation_buffer_size<T> != 0) {
+			array_size_t smaller = left_size < right_size ? left_size : right_size;
+			if (smaller <= rotation_buffer_size<T>) {
+				T buffer[rotation_buffer_size<T>];
+				rotateWithBuffer(array, start, left_size, right_size, buffer, metrics);
+				return;
+			}
+		}
+
+		if constexpr (sizeof(T) >= min_juggled_element_size) {
+			rotateByJuggling(array, start, left_size, right_size, metrics);
+		} else {
+			rotateByTrinity(array, start, left_size, right_size, metrics);
+		}
+	}
+
+	template <typename T, typename Metrics>
+	void rotate(T* array, array_size_t start,
+				array_size_t left_size, array_size_t right_size,
+				RotationKernel kernel, Metrics *metrics) {
+
+		switch (kernel) {
+		case RotationKernel::REVERSAL:
+			rotateByReversal(array, start, left_size, right_size, metrics);
+			break;
+		case RotationKernel::BLOCK_SWAP:
+			rotateByBlockSwap(array, start, left_size, right_size, metrics);
+			break;
+		case RotationKernel::JUGGLING:
+			rotateByJuggling(array, start, left_size, right_size, metrics);
+			break;
+		case RotationKernel::TRINITY:
+			rotateByTrinity(array, start, left_size, right_size, metrics);
+			break;
+		//	the buffer is on the stack, so rotate() uses it only when it fits
+		case RotationKernel::BUFFERED:
+		default:
+			rotate(array, start, left_size, right_size, metrics);
+			break;
+		}
+	}
+
+	template <typename T, typename Metrics>
+	void rotateByReversal(T* array, array_size_t start,
+						  array_size_t left_size, array_size_t right_size,
+						  Metrics *metrics) {
+
+		auto reverse = [&] (array_size_t i, array_size_t j) {
+			if (metrics && i < j) metrics->assignments += 3 * ((j - i + 1) / 2);
+			for (; i < j; i++, j--) {
+				T temp	 = array[i];
+				array[i] = array[j];
+				array[j] = temp;
+			}
+		};
+		reverse(start, start + left_size - 1);
+		reverse(start + left_size, start + left_size + right_size - 1);
+		reverse(start, start + left_size + right_size - 1);
+	}
+
+	template <typename T, typename Metrics>
+	void rotateByBlockSwap(T* array, array_size_t start,
+						   array_size_t left_size, array_size_t right_size,
+						   Metrics *metrics) {
+
+		while (left_size > 0 && right_size > 0) {
+			if (left_size <= right_size) {
+				//	[L][R1 R2] -> [R1][L][R2], then rotate [L][R2]
+				swapSpans(array, start, start + left_size, left_size, metrics);
+				start		+= left_size;
+				right_size	-= left_size;
+			} else {
+				//	[L1 L2][R] -> [L1][R][L2], then rotate [L1][R]
+				swapSpans(array, start + left_size - right_size, start + left_size,
+						  right_size, metrics);
+				left_size	-= right_size;
+			}
+		}
+	}
+
+	template <typename T, typename Metrics>
+	void rotateByJuggling(T* array, array_size_t start,
+						  array_size_t left_size, array_size_t right_size,
+						  Metrics *metrics) {
+
+		if (left_size <= 0 || right_size <= 0)
+			return;
+
+		array_size_t size 		= left_size + right_size;
+		array_size_t num_cycles = std::gcd(size, left_size);
+
+		//	the element at i goes to i - left_size, modulo the size
+		for (array_size_t cycle = 0; cycle != num_cycles; cycle++) {
+			if (metrics) metrics->assignments++;
+			T temp = array[start + cycle];
+			array_size_t to = cycle;
+			while (true) {
+				array_size_t from = to + left_size;
+				if (from >= size)
+					from -= size;
+				if (from == cycle)
+					break;
+				if (metrics) metrics->assignments++;
+				array[start + to] = array[start + from];
+				to = from;
+			}
+			if (metrics) metrics->assignments++;
+			array[start + to] = temp;
+		}
+	}
+
+	template <typename T, typename Metrics>
+	void rotateWithBuffer(T* array, array_size_t start,
+						  array_size_t left_size, array_size_t right_size,
+						  T* buffer, Metrics *metrics) {
+
+		if (left_size <= 0 || right_size <= 0)
+			return;
+
+		if (left_size <= right_size) {
+			if (metrics) metrics->assignments += left_size + right_size + left_size;
+			for (array_size_t i = 0; i != left_size; i++) {
+				buffer[i] = array[start + i];
+			}
+			for (array_size_t i = 0; i != right_size; i++) {
+				array[start + i] = array[start + left_size + i];
+			}
+			for (array_size_t i = 0; i != left_size; i++) {
+				array[start + right_size + i] = buffer[i];
+			}
+		} else {
+			if (metrics) metrics->assignments += left_size + right_size + right_size;
+			for (array_size_t i = 0; i != right_size; i++) {
+				buffer[i] = array[start + left_size + i];
+			}
+			for (array_size_t i = left_size; i-- != 0; ) {
+				array[start + right_size + i] = array[start + i];
+			}
+			for (array_size_t i = 0; i != right_size; i++) {
+				array[start + i] = buffer[i];
+			}
+		}
+	}
+
+	/*
+	 * 	a, b, c & d start at the start of the left span, the end of the
+	 * 	left span, the start of the right span & the end of the right span.
+	 * 	While both spans have elements to reverse, each step moves four
+	 * 	elements one place along the cycle a <- c <- d <- b <- a.  When the
+	 * 	smaller span is reversed, the rest of the larger span is reversed
+	 * 	along with the whole, three elements at a time, and what is left
+	 * 	is a single reversal.
+	 */
+
+	template <typename T, typename Metrics>
+	void rotateByTrinity(T* array, array_size_t start,
+						 array_size_t left_size, array_size_t right_size,
+						 Metrics *metrics) {
+
+		if (left_size <= 0 || right_size <= 0)
+			return;
+
+		array_size_t a = start;
+		array_size_t b = start + left_size;
+		array_size_t c = b;
+		array_size_t d = b + right_size;
+
+		array_size_t steps = (left_size < right_size ? left_size : right_size) / 2;
+		if (metrics) metrics->assignments += 5 * steps;
+		for (; steps != 0; steps--) {
+			T temp		= array[--b];
+			array[b]	= array[a];
+			array[a++]	= array[c];
+			array[c++]	= array[--d];
+			array[d]	= temp;
+		}
+
+		if (left_size < right_size) {
+			steps = (d - c) / 2;
+			if (metrics) metrics->assignments += 4 * steps;
+			for (; steps != 0; steps--) {
+				T temp		= array[c];
+				array[c++]	= array[--d];
+				array[d]	= array[a];
+				array[a++]	= temp;
+			}
+		} else {
+			steps = (b - a) / 2;
+			if (metrics) metrics->assignments += 4 * steps;
+			for (; steps != 0; steps--) {
+				T temp		= array[--b];
+				array[b]	= array[a];
+				array[a++]	= array[--d];
+				array[d]	= temp;
+			}
+		}
+
+		steps = (d - a) / 2;
+		if (metrics) metrics->assignments += 3 * steps;
+		for (; steps != 0; steps--) {
+			T temp		= array[a];
+			array[a++]	= array[--d];
+			array[d]	= temp;
+		}
+	}
+
+	template <typename T, typename Metrics>
+	void swapSpans(T* array, array_size_t a, array_size_t b, array_size_t size,
+				   Metrics *metrics) {
+
+		if (metrics && size > 0) metrics->assignments += 3 * size;
+		for (array_size_t i = 0; i < size; i++) {
+			T temp		 = array[a + i];
+			array[a + i] = array[b + i];
+			array[b + i] = temp;
+		}
+	}
+}
+
+#endif /* ROTATION_H_ */
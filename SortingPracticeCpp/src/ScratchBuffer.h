@@ -0,0 +1,109 @@
+/*
+ * ScratchBuffer.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Joe Baker
+ */
+
+/*	Auxiliary arrays for the sorts that need one (MergeSort, RadixSort,
+ *	  CountingSort).  The array is on the heap rather than the stack, so
+ *	  large arrays of large objects do not overflow the stack.  It is kept
+ *	  between sorts, so repeated sorts of the same size do not pay for an
+ *	  allocation and for default constructing every element each time.
+ *
+ *	A ScratchBuffer can be owned by the caller and passed to a sort.
+ *	  Otherwise, a sort leases the calling thread's buffer for the element
+ *	  type.  If that buffer is already leased, e.g. by a sort that calls
+ *	  another sort, the lease gets a private buffer that is freed when the
+ *	  lease ends.
+ */
+
+#ifndef SCRATCHBUFFER_H_
+#define SCRATCHBUFFER_H_
+
+#include <memory>
+
+#include "MemoryAccounting.h"
+#include "SortingDataTypes.h"
+
+template <typename T>
+class ScratchBuffer {
+private:
+	std::unique_ptr<T[]>	m_data;
+	array_size_t			m_capacity = 0;
+	bool					m_is_leased = false;
+
+	template <typename U> friend class ScratchLease;
+
+public:
+	ScratchBuffer() {}
+	explicit ScratchBuffer(array_size_t capacity) {	reserve(capacity);	}
+
+	ScratchBuffer(const ScratchBuffer&) = delete;
+	ScratchBuffer& operator=(const ScratchBuffer&) = delete;
+
+	//	Returns an array of at least 'size' elements.  The contents are
+	//	  whatever was left by the previous user.  Growing does not keep them
+	T* reserve(array_size_t size) {
+		if (size > m_capacity) {
+			m_data.reset(new T[size]);
+			m_capacity = size;
+		}
+		return m_data.get();
+	}
+
+	array_size_t capacity(void) const	{	return m_capacity;	}
+
+	//	Frees the memory
+	void release(void) {
+		m_data.reset();
+		m_capacity = 0;
+	}
+
+	//	The buffer that sorts on this thread use when they are not given one
+	static ScratchBuffer& forThisThread(void) {
+		thread_local ScratchBuffer buffer;
+		return buffer;
+	}
+};
+
+/*	A sort's use of a ScratchBuffer, for the duration of the sort	*/
+
+template <typename T>
+class ScratchLease {
+private:
+	ScratchBuffer<T>*	m_buffer;
+	ScratchBuffer<T>	m_private;
+	T*					m_data;
+	size_t				m_leased_bytes;		// what was already allocated
+
+public:
+	//	Leases 'buffer' if one is passed, otherwise the thread's buffer
+	explicit ScratchLease(array_size_t size, ScratchBuffer<T>* buffer = nullptr) {
+		if (buffer == nullptr) {
+			buffer = &ScratchBuffer<T>::forThisThread();
+		}
+		if (buffer->m_is_leased) {
+			buffer = &m_private;
+		}
+		buffer->m_is_leased = true;
+		m_buffer 			= buffer;
+		//	a buffer that grows is counted by operator new
+		m_leased_bytes		= size <= buffer->m_capacity ? size * sizeof(T) : 0;
+		m_data 				= buffer->reserve(size);
+		MemoryAccounting::beginLease(m_leased_bytes);
+	}
+
+	~ScratchLease() {
+		MemoryAccounting::endLease(m_leased_bytes);
+		m_buffer->m_is_leased = false;
+	}
+
+	ScratchLease(const ScratchLease&) = delete;
+	ScratchLease& operator=(const ScratchLease&) = delete;
+
+	T* get(void) const					{	return m_data;	}
+	T& operator[](array_size_t i) const	{	return m_data[i];	}
+};
+
+#endif /* SCRATCHBUFFER_H_ */
@@ -19,16 +19,16 @@ namespace SelectionSort {
 	/*	**************************************************************	*/
 
 	// Declare the function with default value for SortMetrics pointer
-	template <typename T>
-	void sort(T *array, array_size_t array_size, SortMetrics *metrics = nullptr);
+	template <typename T, typename Metrics = SortMetrics>
+	void sort(T *array, array_size_t array_size, Metrics *metrics = nullptr);
 
 
 	/*	**************************************************************	*/
 	/*							function definition						*/
 	/*	**************************************************************	*/
 
-	template <typename T>
-	void sort(T *array, array_size_t array_size, SortMetrics *metrics) {
+	template <typename T, typename Metrics>
+	void sort(T *array, array_size_t array_size, Metrics *metrics) {
 
 		if (!SortingUtilities::isSorted(array, array_size, metrics))
 		{
@@ -0,0 +1,289 @@
+/*
+ * SimdSortingNetwork.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Joe Baker
+ */
+
+#ifndef SIMDSORTINGNETWORK_H_
+#define SIMDSORTINGNETWORK_H_
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+//	The register sort is compiled for AVX2 whatever the build targets, and
+//	  only run if the processor has it
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SIMD_SORTING_NETWORK_AVX2
+#define SIMD_AVX2_TARGET __attribute__((target("avx2")))
+#include <immintrin.h>
+#endif
+
+#include "SortingDataTypes.h"
+#include "InsertionSort.h"
+#include "SortingNetworks.h"
+
+/*
+ * 	A base case for the sorts that finish small spans with an insertion
+ * 	sort.  When the processor has AVX2, arrays of up to 32 int32_t,
+ * 	int64_t, float or double are sorted in 256 bit registers with a
+ * 	bitonic sorting network:  every step is a permute of a register, a
+ * 	min and a max, and a blend, so there are no branches and no
+ * 	element-by-element moves.  Spans that are not a multiple of the
+ * 	register width are padded with the largest value of the type.
+ *
+ * 	Without AVX2, and for the other arithmetic types, the span is sorted
+ * 	with the scalar networks in SortingNetworks.h.  Every other type uses
+ * 	InsertionSort, which keeps the sorts that call this stable.
+ *
+ * 	A network is not stable, which cannot be seen with integers.  For
+ * 	floating point, -0.0 and 0.0 may come out in either order, and NaN
+ * 	is not supported, the same as with operator<.
+ */
+
+namespace SimdSortingNetwork {
+
+	//	The largest span that is sorted in registers
+	constexpr array_size_t max_size = 32;
+
+	//	True if arrays of T can be sorted in registers in this build
+#if defined(SIMD_SORTING_NETWORK_AVX2)
+	template <typename T>
+	struct is_vectorized : std::integral_constant<bool,
+		std::is_same<T, float>::value  ||
+		std::is_same<T, double>::value ||
+		(std::is_integral<T>::value && std::is_signed<T>::value &&
+		 (sizeof(T) == 4 || sizeof(T) == 8))> {};
+#else
+	template <typename T>
+	struct is_vectorized : std::false_type {};
+#endif
+
+	/*	**********************************************************	*/
+	/*						function declarations					*/
+	/*	**********************************************************	*/
+
+	// Declare the function with default value for SortMetrics pointer
+	template <typename T, typename Metrics = SortMetrics>
+	void sort(T* array, array_size_t size, Metrics *metrics = nullptr);
+
+#if defined(SIMD_SORTING_NETWORK_AVX2)
+	//	True if the processor this is running on has AVX2
+	inline bool hasAvx2(void);
+
+	template <typename T, typename Metrics = SortMetrics>
+	SIMD_AVX2_TARGET
+	void sortInRegisters(T* array, array_size_t size, Metrics *metrics = nullptr);
+
+	//	Sorts 'num_registers' registers of elements, padded as needed
+	template <typename T, int num_registers, typename Metrics = SortMetrics>
+	SIMD_AVX2_TARGET
+	void bitonicSort(T* array, array_size_t size, Metrics *metrics = nullptr);
+
+	//	One layer of the network between lanes of the same register
+	template <typename T>
+	SIMD_AVX2_TARGET
+	inline __m256i exchangeInRegister(__m256i v, int j, int k, int r);
+
+	template <typename T>
+	SIMD_AVX2_TARGET
+	inline __m256i minOf(__m256i a, __m256i b);
+
+	template <typename T>
+	SIMD_AVX2_TARGET
+	inline __m256i maxOf(__m256i a, __m256i b);
+#endif
+
+
+	/*	**********************************************************	*/
+	/*						function definitions					*/
+	/*	**********************************************************	*/
+
+	template <typename T, typename Metrics>
+	void sort(T* array, array_size_t size, Metrics *metrics) {
+
+		if (size <= 1)
+			return;
+
+#if defined(SIMD_SORTING_NETWORK_AVX2)
+		if constexpr (is_vectorized<T>::value) {
+			if (size <= max_size && hasAvx2()) {
+				sortInRegisters(array, size, metrics);
+				return;
+			}
+		}
+#endif
+		if constexpr (std::is_arithmetic<T>::value) {
+			if (size <= SortingNetworks::max_size) {
+				SortingNetworks::sort(array, size, metrics);
+				return;
+			}
+		}
+		InsertionSort::sort(array, size, metrics);
+	}
+
+#if defined(SIMD_SORTING_NETWORK_AVX2)
+
+	inline bool hasAvx2(void) {
+#if defined(__AVX2__)
+		return true;
+#else
+		static const bool has_avx2 = __builtin_cpu_supports("avx2");
+		return has_avx2;
+#endif
+	}
+
+	template <typename T, typename Metrics>
+	SIMD_AVX2_TARGET
+	void sortInRegisters(T* array, array_size_t size, Metrics *metrics) {
+
+		constexpr int lanes = 32 / sizeof(T);
+
+		if (size <= lanes) {
+			bitonicSort<T, 1>(array, size, metrics);
+		} else if (size <= 2*lanes) {
+			bitonicSort<T, 2>(array, size, metrics);
+		} else if (size <= 4*lanes) {
+			bitonicSort<T, 4>(array, size, metrics);
+		} else {
+			bitonicSort<T, 8>(array, size, metrics);
+		}
+	}
+
+	/*
+	 * 	The bitonic sort of n elements, where element 'i' is in register
+	 * 	i/lanes.  In the layer (k, j), element 'i' is compared with element
+	 * 	i^j, and keeps the smaller of the two if i is the lower index of the
+	 * 	pair and (i & k) == 0, or if it is the upper index and (i & k) != 0.
+	 *
+	 * 	When j is at least the number of lanes, the pairs are in different
+	 * 	registers, lane for lane, so the layer is just a min and a max of
+	 * 	whole registers.
+	 */
+
+	template <typename T, int num_registers, typename Metrics>
+	SIMD_AVX2_TARGET
+	void bitonicSort(T* array, array_size_t size, Metrics *metrics) {
+
+		constexpr int lanes = 32 / sizeof(T);
+		constexpr int n		= num_registers * lanes;
+
+		const T padding = std::numeric_limits<T>::has_infinity ?
+						  std::numeric_limits<T>::infinity() :
+						  std::numeric_limits<T>::max();
+
+		alignas(32) T buffer[n];
+		if (metrics) metrics->assignments += size;
+		for (array_size_t i = 0; i != size; i++) {
+			buffer[i] = array[i];
+		}
+		for (array_size_t i = size; i != n; i++) {
+			buffer[i] = padding;
+		}
+
+		__m256i v[num_registers];
+		for (int r = 0; r != num_registers; r++) {
+			v[r] = _mm256_load_si256(reinterpret_cast<const __m256i*>(&buffer[r*lanes]));
+		}
+
+		for (int k = 2; k <= n; k *= 2) {
+			for (int j = k/2; j > 0; j /= 2) {
+				if (metrics) metrics->compares += n/2;
+				if (j < lanes) {
+					for (int r = 0; r != num_registers; r++) {
+						v[r] = exchangeInRegister<T>(v[r], j, k, r);
+					}
+					continue;
+				}
+				for (int r = 0; r != num_registers; r++) {
+					int other = r ^ (j / lanes);
+					if (other < r) {
+						continue;
+					}
+					__m256i lo = minOf<T>(v[r], v[other]);
+					__m256i hi = maxOf<T>(v[r], v[other]);
+					bool ascending = ((r * lanes) & k) == 0;
+					v[r]	 = ascending ? lo : hi;
+					v[other] = ascending ? hi : lo;
+				}
+			}
+		}
+
+		for (int r = 0; r != num_registers; r++) {
+			_mm256_store_si256(reinterpret_cast<__m256i*>(&buffer[r*lanes]), v[r]);
+		}
+		if (metrics) metrics->assignments += size;
+		for (array_size_t i = 0; i != size; i++) {
+			array[i] = buffer[i];
+		}
+	}
+
+	/*
+	 * 	The permute works on 32 bit slots, so a 64 bit element is moved as
+	 * 	a pair of slots.  The blend takes the max in the lanes that keep the
+	 * 	larger element of their pair, and the min in the others.
+	 */
+
+	template <typename T>
+	SIMD_AVX2_TARGET
+	inline __m256i exchangeInRegister(__m256i v, int j, int k, int r) {
+
+		constexpr int lanes 		 = 32 / sizeof(T);
+		constexpr int slots_per_lane = sizeof(T) / 4;
+
+		alignas(32) int32_t partner[8];
+		alignas(32) int32_t take_max[8];
+		for (int s = 0; s != 8; s++) {
+			int lane 		= s / slots_per_lane;
+			int other		= lane ^ j;
+			bool ascending	= ((r*lanes + lane) & k) == 0;
+			partner[s]		= other * slots_per_lane + s % slots_per_lane;
+			take_max[s]		= (lane > other) == ascending ? -1 : 0;
+		}
+
+		__m256i swapped = _mm256_permutevar8x32_epi32(v,
+							_mm256_load_si256(reinterpret_cast<const __m256i*>(partner)));
+		return _mm256_blendv_epi8(minOf<T>(v, swapped), maxOf<T>(v, swapped),
+							_mm256_load_si256(reinterpret_cast<const __m256i*>(take_max)));
+	}
+
+	//	AVX2 has no 64 bit integer min or max, so they are a compare and a blend
+	template <typename T>
+	SIMD_AVX2_TARGET
+	inline __m256i minOf(__m256i a, __m256i b) {
+
+		if constexpr (std::is_same<T, float>::value) {
+			return _mm256_castps_si256(_mm256_min_ps(_mm256_castsi256_ps(a),
+													 _mm256_castsi256_ps(b)));
+		} else if constexpr (std::is_same<T, double>::value) {
+			return _mm256_castpd_si256(_mm256_min_pd(_mm256_castsi256_pd(a),
+													 _mm256_castsi256_pd(b)));
+		} else if constexpr (sizeof(T) == 4) {
+			return _mm256_min_epi32(a, b);
+		} else {
+			return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b));
+		}
+	}
+
+	template <typename T>
+	SIMD_AVX2_TARGET
+	inline __m256i maxOf(__m256i a, __m256i b) {
+
+		if constexpr (std::is_same<T, float>::value) {
+			return _mm256_castps_si256(_mm256_max_ps(_mm256_castsi256_ps(a),
+													 _mm256_castsi256_ps(b)));
+		} else if constexpr (std::is_same<T, double>::value) {
+			return _mm256_castpd_si256(_mm256_max_pd(_mm256_castsi256_pd(a),
+													 _mm256_castsi256_pd(b)));
+		} else if constexpr (sizeof(T) == 4) {
+			return _mm256_max_epi32(a, b);
+		} else {
+			return _mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(a, b));
+		}
+	}
+
+#endif /* SIMD_SORTING_NETWORK_AVX2 */
+}
+
+#endif /* SIMDSORTINGNETWORK_H_ */
@@ -0,0 +1,84 @@
+/*
+ * SimdSortingNetwork_test.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Joe Baker
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <cstdint>
+#include <string>
+
+#include "SimdSortingNetwork.h"
+#include "TestFixtures.h"
+
+/*
+ * 	Every size from 0 to SimdSortingNetwork::max_size + 8 is sorted, so
+ * 	both the register sort and the sizes past it are tested, with pseudo
+ * 	random values, with values that repeat, and with values that are
+ * 	already in order and in reverse order.  Each result must match
+ * 	std::sort of the same values.
+ */
+
+namespace {
+
+	constexpr int num_arrays_per_size = 1000;
+
+	template <typename T>
+	bool testSimdSortingNetwork(const char *type_name) {
+
+		constexpr int max_size = SimdSortingNetwork::max_size + 8;
+
+		T 		 array[max_size];
+		T 		 expected[max_size];
+		uint64_t state = 0x9E3779B97F4A7C15ull;
+
+		for (int size = 0; size <= max_size; size++) {
+			for (int n = 0; n != num_arrays_per_size; n++) {
+				for (int i = 0; i != size; i++) {
+					// xorshift64
+					state ^= state << 13;
+					state ^= state >> 7;
+					state ^= state << 17;
+					int64_t bits = static_cast<int64_t>(state);
+					switch (n % 4) {
+					case 0:		array[i] = static_cast<T>(bits);		break;
+					case 1:		array[i] = static_cast<T>(bits % 4);	break;
+					case 2:		array[i] = static_cast<T>(i);			break;
+					default:	array[i] = static_cast<T>(-i);			break;
+					}
+					expected[i] = array[i];
+				}
+
+				std::sort(expected, expected + size);
+				SimdSortingNetwork::sort(array, size);
+
+				for (int i = 0; i != size; i++) {
+					if (array[i] != expected[i]) {
+						std::cout << "ERROR: " << type_name << " array of " << size
+								  << " elements was not sorted at [" << i << "]"
+								  << std::endl;
+						return false;
+					}
+				}
+			}
+		}
+		std::cout << type_name << " arrays of 0 to " << max_size << " elements sorted\n";
+		return true;
+	}
+}
+
+bool testSimdSortingNetwork() {
+
+#if defined(SIMD_SORTING_NETWORK_AVX2)
+	std::cout << "The register sort is "
+			  << (SimdSortingNetwork::hasAvx2() ? "" : "not ")
+			  << "run on this processor\n";
+#endif
+	return testSimdSortingNetwork<int32_t>("int32_t") &&
+		   testSimdSortingNetwork<int64_t>("int64_t") &&
+		   testSimdSortingNetwork<float>("float") &&
+		   testSimdSortingNetwork<double>("double");
+}
@@ -0,0 +1,190 @@
+/*
+ * SmoothSort.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Joe Baker
+ */
+
+#ifndef SMOOTHSORT_H_
+#define SMOOTHSORT_H_
+
+#include <iostream>
+#include <iomanip>
+
+#include "SortingDataTypes.h"
+#include "SortingUtilities.h"
+
+/*
+ * 	Dijkstra's smooth sort.  Like heap sort, it builds a heap and then
+ * 	takes the largest element off of it n times, but the heap is a list of
+ * 	Leonardo heaps, from left to right, whose sizes are Leonardo numbers:
+ *
+ * 		L(0) = L(1) = 1,	L(k) = L(k-1) + L(k-2) + 1
+ *
+ * 	A heap of order k >= 2 is its root at its right end, after a heap of
+ * 	order k-1 and a heap of order k-2.  The roots of the heaps increase
+ * 	from left to right, so the largest element is always the last one.
+ *
+ * 	In a sorted array, every new element is already >= every root, so
+ * 	adding it and later taking it off each take a few compares and the
+ * 	sort is O(n).  The more elements that are out of place, the closer it
+ * 	gets to O(n log n), which is its worst case.  The only extra memory is
+ * 	the list of the orders of the heaps, which is at most 90 entries.
+ */
+
+namespace SmoothSort {
+
+	//	L(89) is the largest Leonardo number that is an array_size_t
+	constexpr int num_leonardo_numbers = 90;
+
+	struct LeonardoNumbers {
+		array_size_t value[num_leonardo_numbers];
+
+		constexpr LeonardoNumbers() : value() {
+			value[0] = 1;
+			value[1] = 1;
+			for (int k = 2; k != num_leonardo_numbers; k++) {
+				value[k] = value[k-1] + value[k-2] + 1;
+			}
+		}
+		constexpr array_size_t operator[](int k) const {	return value[k];	}
+	};
+
+	constexpr LeonardoNumbers leonardo;
+
+	//	The orders of the heaps, from left to right
+	struct HeapList {
+		int order[num_leonardo_numbers+1];
+		int size = 0;
+	};
+
+	/*	**********************************************************	*/
+	/*						function declarations					*/
+	/*	**********************************************************	*/
+
+	// Declare the functions with default parameter for SortMetrics*
+	template <typename T, typename Metrics = SortMetrics>
+	void sort(T* array, array_size_t size, Metrics *metrics = nullptr);
+
+	//	Sinks the root at 'root' of a heap of 'order' into the heap
+	template <typename T, typename Metrics = SortMetrics>
+	void sinkRoot(T* array, array_size_t root, int order,
+				  Metrics *metrics = nullptr);
+
+	//	Moves the root of heaps.order[heap] to the left past the roots that
+	//	  are larger than it, then sinks it into the heap it stops in
+	template <typename T, typename Metrics = SortMetrics>
+	void trinkle(T* array, array_size_t root, HeapList &heaps, int heap,
+				 Metrics *metrics = nullptr);
+
+
+	/*	**********************************************************	*/
+	/*						function definitions					*/
+	/*	**********************************************************	*/
+
+	template <typename T, typename Metrics>
+	void sort(T* array, array_size_t size, Metrics *metrics) {
+
+		if (size <= 1)
+			return;
+
+		HeapList heaps;
+
+		//	add each element to the list of heaps
+		for (array_size_t i = 0; i != size; i++) {
+			int n = heaps.size;
+			if (n >= 2 && heaps.order[n-2] == heaps.order[n-1] + 1) {
+				// the element becomes the root of the last two heaps
+				heaps.size--;
+				heaps.order[n-2]++;
+			} else if (n >= 1 && heaps.order[n-1] == 1) {
+				heaps.order[heaps.size++] = 0;
+			} else {
+				heaps.order[heaps.size++] = 1;
+			}
+			trinkle(array, i, heaps, heaps.size-1, metrics);
+		}
+
+		//	the largest element is the root of the last heap.  Removing it
+		//	  leaves the heap's two sub-heaps, whose roots are put in order
+		for (array_size_t root = size-1; root > 0; root--) {
+			int last  = heaps.size-1;
+			int order = heaps.order[last];
+			if (order <= 1) {
+				heaps.size--;
+				continue;
+			}
+			array_size_t right_root = root-1;
+			array_size_t left_root	= right_root - leonardo[order-2];
+			heaps.order[last] 		= order-1;
+			heaps.order[heaps.size++] = order-2;
+			trinkle(array, left_root, heaps, last, metrics);
+			trinkle(array, right_root, heaps, last+1, metrics);
+		}
+	}
+
+	/*
+	 * 	The children of the root of a heap of order k are the roots of the
+	 * 	sub-heaps, [root-1] of order k-2 and [root-1-L(k-2)] of order k-1
+	 */
+
+	template <typename T, typename Metrics>
+	void sinkRoot(T* array, array_size_t root, int order, Metrics *metrics) {
+
+		while (order >= 2) {
+			array_size_t right_child = root-1;
+			array_size_t left_child	 = right_child - leonardo[order-2];
+
+			array_size_t larger_child	= left_child;
+			int			 child_order	= order-1;
+			if (metrics) metrics->compares++;
+			if (array[left_child] < array[right_child]) {
+				larger_child = right_child;
+				child_order	 = order-2;
+			}
+
+			if (metrics) metrics->compares++;
+			if (!(array[root] < array[larger_child]))
+				break;
+			SortingUtilities::swap(array, root, larger_child, metrics);
+			root  = larger_child;
+			order = child_order;
+		}
+	}
+
+	/*
+	 * 	The root moves left while the root of the heap to its left is larger
+	 * 	than it and larger than both of its children, which keeps every heap
+	 * 	it passes in heap order.
+	 */
+
+	template <typename T, typename Metrics>
+	void trinkle(T* array, array_size_t root, HeapList &heaps, int heap,
+				 Metrics *metrics) {
+
+		while (heap > 0) {
+			int			 order 	  = heaps.order[heap];
+			array_size_t previous = root - leonardo[order];
+
+			if (metrics) metrics->compares++;
+			if (!(array[root] < array[previous]))
+				break;
+
+			if (order >= 2) {
+				array_size_t right_child = root-1;
+				array_size_t left_child	 = right_child - leonardo[order-2];
+				if (metrics) metrics->compares += 2;
+				if (!(array[right_child] < array[previous]) ||
+					!(array[left_child] < array[previous])) {
+					break;
+				}
+			}
+			SortingUtilities::swap(array, root, previous, metrics);
+			root = previous;
+			heap--;
+		}
+		sinkRoot(array, root, heaps.order[heap], metrics);
+	}
+}
+
+#endif /* SMOOTHSORT_H_ */
@@ -18,14 +18,28 @@ bool isValid(SortAlgorithms algorithm) {
 	case SortAlgorithms::SELECTION_SORT:
 	case SortAlgorithms::INSERTION_SORT:
 	case SortAlgorithms::MERGE_SORT:
+	case SortAlgorithms::PARALLEL_MERGE_SORT:
+	case SortAlgorithms::TIM_SORT:
+	case SortAlgorithms::POWER_SORT:
 	case SortAlgorithms::HEAP_SORT:
+	case SortAlgorithms::BOTTOM_UP_HEAP_SORT:
+	case SortAlgorithms::D_ARY_HEAP_SORT:
+	case SortAlgorithms::SMOOTH_SORT:
 	case SortAlgorithms::QUICK_SORT:
 	case SortAlgorithms::PROTECTED_QUICK_SORT:
+	case SortAlgorithms::INTRO_SORT:
+	case SortAlgorithms::PATTERN_DEFEATING_QUICK_SORT:
+	case SortAlgorithms::BLOCK_QUICK_SORT:
+	case SortAlgorithms::DUAL_PIVOT_QUICK_SORT:
+	case SortAlgorithms::PARALLEL_QUICK_SORT:
 	case SortAlgorithms::DUTCH_FLAG_SORT:
 	case SortAlgorithms::RADIX_SORT:
 	case SortAlgorithms::COUNTING_SORT:
 	case SortAlgorithms::INPLACE_MERGE:
 	case SortAlgorithms::BLOCK_SORT:
+	case SortAlgorithms::BLOCK_SORT_INTERNAL_BUFFER:
+	case SortAlgorithms::STD_SORT:
+	case SortAlgorithms::STD_STABLE_SORT:
 		return true;
 		break;
 	case SortAlgorithms::INVALID_SORT:
@@ -45,14 +59,30 @@ std::string to_string(SortAlgorithms algorithm) {
 	case SortAlgorithms::SELECTION_SORT:		return std::string(SORT_ALGORITHM_SELECTION_SORT_STRING);
 	case SortAlgorithms::INSERTION_SORT:		return std::string(SORT_ALGORITHM_INSERTION_SORT_STRING);
 	case SortAlgorithms::MERGE_SORT:			return std::string(SORT_ALGORITHM_MERGE_SORT_STRING);
+	case SortAlgorithms::PARALLEL_MERGE_SORT:	return std::string(SORT_ALGORITHM_PARALLEL_MERGE_SORT_STRING);
+	case SortAlgorithms::TIM_SORT:				return std::string(SORT_ALGORITHM_TIM_SORT_STRING);
+	case SortAlgorithms::POWER_SORT:			return std::string(SORT_ALGORITHM_POWER_SORT_STRING);
 	case SortAlgorithms::HEAP_SORT:				return std::string(SORT_ALGORITHM_HEAP_SORT_STRING);
+	case SortAlgorithms::BOTTOM_UP_HEAP_SORT:	return std::string(SORT_ALGORITHM_BOTTOM_UP_HEAP_SORT_STRING);
+	case SortAlgorithms::D_ARY_HEAP_SORT:		return std::string(SORT_ALGORITHM_D_ARY_HEAP_SORT_STRING);
+	case SortAlgorithms::SMOOTH_SORT:			return std::string(SORT_ALGORITHM_SMOOTH_SORT_STRING);
 	case SortAlgorithms::QUICK_SORT:			return std::string(SORT_ALGORITHM_QUICK_SORT_STRING);
 	case SortAlgorithms::PROTECTED_QUICK_SORT:	return std::string(SORT_ALGORITHM_PROTECTED_QUICK_SORT_STRING);
+	case SortAlgorithms::INTRO_SORT:			return std::string(SORT_ALGORITHM_INTRO_SORT_STRING);
+	case SortAlgorithms::PATTERN_DEFEATING_QUICK_SORT:
+												return std::string(SORT_ALGORITHM_PATTERN_DEFEATING_QUICK_SORT_STRING);
+	case SortAlgorithms::BLOCK_QUICK_SORT:		return std::string(SORT_ALGORITHM_BLOCK_QUICK_SORT_STRING);
+	case SortAlgorithms::DUAL_PIVOT_QUICK_SORT:	return std::string(SORT_ALGORITHM_DUAL_PIVOT_QUICK_SORT_STRING);
+	case SortAlgorithms::PARALLEL_QUICK_SORT:	return std::string(SORT_ALGORITHM_PARALLEL_QUICK_SORT_STRING);
 	case SortAlgorithms::DUTCH_FLAG_SORT:		return std::string(SORT_ALGORITHM_DUTCH_FLAG_SORT_STRING);
 	case SortAlgorithms::RADIX_SORT:			return std::string(SORT_ALGORITHM_RADIX_SORT_STRING);
 	case SortAlgorithms::COUNTING_SORT:			return std::string(SORT_ALGORITHM_COUNTING_SORT_STRING);
 	case SortAlgorithms::INPLACE_MERGE:			return std::string(SORT_ALGORITHM_INPLACE_MERGE_SORT_STRING);
 	case SortAlgorithms::BLOCK_SORT:			return std::string(SORT_ALGORITHM_BLOCK_SORT_STRING);
+	case SortAlgorithms::BLOCK_SORT_INTERNAL_BUFFER:
+												return std::string(SORT_ALGORITHM_BLOCK_SORT_INTERNAL_BUFFER_STRING);
+	case SortAlgorithms::STD_SORT:				return std::string(SORT_ALGORITHM_STD_SORT_STRING);
+	case SortAlgorithms::STD_STABLE_SORT:		return std::string(SORT_ALGORITHM_STD_STABLE_SORT_STRING);
 	case SortAlgorithms::INVALID_SORT:
 	default: 									return std::string(SORT_ALGORITHM_INVALID_SORT_STRING);
 	}
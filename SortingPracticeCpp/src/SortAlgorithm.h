@@ -29,14 +29,28 @@ enum class SortAlgorithms {
 	SELECTION_SORT,
 	INSERTION_SORT,
 	MERGE_SORT,
+	PARALLEL_MERGE_SORT,
+	TIM_SORT,
+	POWER_SORT,
 	HEAP_SORT,
+	BOTTOM_UP_HEAP_SORT,
+	D_ARY_HEAP_SORT,
+	SMOOTH_SORT,
 	QUICK_SORT,
 	PROTECTED_QUICK_SORT,
+	INTRO_SORT,
+	PATTERN_DEFEATING_QUICK_SORT,
+	BLOCK_QUICK_SORT,
+	DUAL_PIVOT_QUICK_SORT,
+	PARALLEL_QUICK_SORT,
 	DUTCH_FLAG_SORT,
 	RADIX_SORT,
 	COUNTING_SORT,
 	INPLACE_MERGE,
 	BLOCK_SORT,
+	BLOCK_SORT_INTERNAL_BUFFER,
+	STD_SORT,
+	STD_STABLE_SORT,
 	INVALID_SORT,
 };
 
@@ -44,14 +58,28 @@ enum class SortAlgorithms {
 #define SORT_ALGORITHM_SELECTION_SORT_STRING		"SELECTION SORT"
 #define SORT_ALGORITHM_INSERTION_SORT_STRING		"INSERTION SORT"
 #define SORT_ALGORITHM_MERGE_SORT_STRING			"MERGE SORT"
+#define SORT_ALGORITHM_PARALLEL_MERGE_SORT_STRING	"PARALLEL MERGE SORT"
+#define SORT_ALGORITHM_TIM_SORT_STRING				"TIM SORT"
+#define SORT_ALGORITHM_POWER_SORT_STRING			"POWER SORT"
 #define SORT_ALGORITHM_HEAP_SORT_STRING				"HEAP SORT"
+#define SORT_ALGORITHM_BOTTOM_UP_HEAP_SORT_STRING	"BOTTOM-UP HEAP SORT"
+#define SORT_ALGORITHM_D_ARY_HEAP_SORT_STRING		"4-ARY HEAP SORT"
+#define SORT_ALGORITHM_SMOOTH_SORT_STRING			"SMOOTH SORT"
 #define SORT_ALGORITHM_QUICK_SORT_STRING			"QUICK SORT"
 #define SORT_ALGORITHM_PROTECTED_QUICK_SORT_STRING	"PROTECTED QUCK SORT"
+#define SORT_ALGORITHM_INTRO_SORT_STRING			"INTRO SORT"
+#define SORT_ALGORITHM_PATTERN_DEFEATING_QUICK_SORT_STRING	"PDQ SORT"
+#define SORT_ALGORITHM_BLOCK_QUICK_SORT_STRING		"BLOCK QUICK SORT"
+#define SORT_ALGORITHM_DUAL_PIVOT_QUICK_SORT_STRING	"DUAL PIVOT QSORT"
+#define SORT_ALGORITHM_PARALLEL_QUICK_SORT_STRING	"PARALLEL QUICK SORT"
 #define SORT_ALGORITHM_DUTCH_FLAG_SORT_STRING		"DUTCH SORT"
 #define SORT_ALGORITHM_RADIX_SORT_STRING			"RADIX SORT"
 #define SORT_ALGORITHM_COUNTING_SORT_STRING			"COUNTING SORT"
 #define SORT_ALGORITHM_INPLACE_MERGE_SORT_STRING	"INPLACE MERGE SORT"
 #define SORT_ALGORITHM_BLOCK_SORT_STRING			"BLOCK SORT"
+#define SORT_ALGORITHM_BLOCK_SORT_INTERNAL_BUFFER_STRING	"BLOCK SORT INT BUFFER"
+#define SORT_ALGORITHM_STD_SORT_STRING				"STD::SORT"
+#define SORT_ALGORITHM_STD_STABLE_SORT_STRING		"STD::STABLE_SORT"
 #define SORT_ALGORITHM_INVALID_SORT_STRING			"INVALID SORT"
 
 bool isValid(SortAlgorithms);
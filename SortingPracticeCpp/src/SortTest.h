@@ -15,6 +15,7 @@
 #include <cstddef>
 #include <cstdlib>
 #include <ctime>
+#include <memory>
 
 #include "ArrayComposition.h"
 #include "SortFailureLog.h"
@@ -22,6 +23,8 @@
 #include "GenerateTestVectors.h"
 #include "MessageList.h"
 #include "OneTestResult.h"		// results of running n tests of a given array length
+#include "PerfCounters.h"
+#include "MemoryAccounting.h"
 #include "ResultOutput.h"
 #include "SimpleRandomizer.h"
 #include "SortAlgorithm.h"
@@ -31,14 +34,22 @@
 
 #include "BlockSort.h"
 #include "BubbleSort.h"
+#include "DualPivotQuickSort.h"
 #include "DutchFlagSort.h"
 #include "InPlaceMerge.h"
 #include "InsertionSort.h"
 #include "SelectionSort.h"
 #include "MergeSort.h"
 #include "HeapSort.h"
+#include "SmoothSort.h"
 #include "ProtectedQuickSort.h"
+#include "PatternDefeatingQuickSort.h"
 #include "QuickSort.h"
+#include "RadixSort.h"
+#include "CountingSort.h"
+#include "TimSort.h"
+#include "StdSort.h"
+#include "CountingKey.h"
 
 
 template <typename T>
@@ -91,7 +102,10 @@ OneTestResult<T>* testOneAlgorithm(	SortAlgorithms& algorithm,
 									SimpleRandomizer& randomizer,
 									T *values,
 									array_size_t array_size,
-									num_repetitions_t num_repetitions)
+									num_repetitions_t num_repetitions,
+									SortClock clock = SortClock::STEADY_CLOCK,
+									PerfCounters *perf_counters = nullptr,
+									bool count_aux_memory = false)
 {
 	OStreamState ostream_state;
 	bool debug_verbose = false;
@@ -105,6 +119,10 @@ OneTestResult<T>* testOneAlgorithm(	SortAlgorithms& algorithm,
 	OneTestResult<T> *retval =
 		new OneTestResult<T>(algorithm, composition, ordering, array_size, num_repetitions);
 	retval->m_is_stable = true;
+	if (!isAvailable(clock))
+		clock = SortClock::STEADY_CLOCK;
+	retval->m_sort_metrics.clock = clock;
+	retval->m_sort_metrics.times.reserve(num_repetitions);
 
 	PermutationGenerator<T> *permutation_generator = nullptr;
 	if (composition.composition == ArrayCompositions::ALL_PERMUTATIONS) {
@@ -122,10 +140,15 @@ OneTestResult<T>* testOneAlgorithm(	SortAlgorithms& algorithm,
 		permutation_generator = new PermutationGenerator<T>(values, array_size);
 	}
 
-	T reference_data[array_size];
-	copy_array(reference_data, values);
+	//	On the heap, so that large arrays do not overflow the stack
+	std::unique_ptr<T[]> reference_storage(new T[array_size]);
+	std::unique_ptr<T[]> sorted_storage(new T[array_size]);
+	std::unique_ptr<T[]> previous_storage(new T[array_size]);
+	T *reference_data	= reference_storage.get();
+	T *sorted_data		= sorted_storage.get();
+	T *previous			= previous_storage.get();
 
-	T sorted_data[array_size];
+	copy_array(reference_data, values);
 
 	std::stringstream msg;
 
@@ -138,9 +161,18 @@ OneTestResult<T>* testOneAlgorithm(	SortAlgorithms& algorithm,
 	case SortAlgorithms::BUBBLE_SORT:
 		sort = BubbleSort::sort;
 		break;
+	case SortAlgorithms::DUAL_PIVOT_QUICK_SORT:
+		sort = DualPivotQuickSort::sort;
+		break;
 	case SortAlgorithms::DUTCH_FLAG_SORT:
 		sort = DutchFlagSort::sort;
 		break;
+	case SortAlgorithms::BOTTOM_UP_HEAP_SORT:
+		sort = HeapSort::sortBottomUp;
+		break;
+	case SortAlgorithms::D_ARY_HEAP_SORT:
+		sort = HeapSort::sortDAry<HeapSort::d_ary_heap_arity, T>;
+		break;
 	case SortAlgorithms::HEAP_SORT:
 		sort = HeapSort::sort;
 		break;
@@ -150,30 +182,81 @@ OneTestResult<T>* testOneAlgorithm(	SortAlgorithms& algorithm,
 	case SortAlgorithms::MERGE_SORT:
 		sort = MergeSort::sort;
 		break;
+	case SortAlgorithms::PARALLEL_MERGE_SORT:
+		sort = MergeSort::parallelSort;
+		break;
+	case SortAlgorithms::TIM_SORT:
+		sort = TimSort::sort;
+		break;
+	case SortAlgorithms::POWER_SORT:
+		//	TimSort's runs and merges with the PowerSort merge policy
+		sort = [](T* array, array_size_t size, SortMetrics *metrics) {
+			TimSort::sort(array, size, TimSort::MergePolicy::POWER_SORT, metrics);
+		};
+		break;
 	case SortAlgorithms::PROTECTED_QUICK_SORT:
 		sort = ProtectedQuickSort::sort;
 		break;
+	case SortAlgorithms::INTRO_SORT:
+		sort = ProtectedQuickSort::introSort;
+		break;
+	case SortAlgorithms::PARALLEL_QUICK_SORT:
+		sort = ProtectedQuickSort::parallelSort;
+		break;
+	case SortAlgorithms::PATTERN_DEFEATING_QUICK_SORT:
+		sort = PatternDefeatingQuickSort::sort;
+		break;
+	case SortAlgorithms::BLOCK_QUICK_SORT:
+		//	introSort() with the branchless block partition kernel
+		sort = [](T* array, array_size_t size, SortMetrics *metrics) {
+			ProtectedQuickSort::introSort(array, size,
+										  PartitionKernels::PartitionStrategy::BLOCK,
+										  metrics);
+		};
+		break;
 	case SortAlgorithms::QUICK_SORT:
 		sort = QuickSort::sort;
 		break;
+	case SortAlgorithms::SMOOTH_SORT:
+		sort = SmoothSort::sort;
+		break;
 	case SortAlgorithms::SELECTION_SORT:
 		sort = SelectionSort::sort;
 		break;
 	case SortAlgorithms::BLOCK_SORT:
 		sort = BlockSort::sort;
 		break;
+	case SortAlgorithms::BLOCK_SORT_INTERNAL_BUFFER:
+		sort = BlockSort::InternalBuffer::sort;
+		break;
 	case SortAlgorithms::INPLACE_MERGE:
 		sort = InPlaceMerge::sort;
 		break;
+	case SortAlgorithms::STD_SORT:
+		sort = StdSort::sort;
+		break;
+	case SortAlgorithms::STD_STABLE_SORT:
+		sort = StdSort::stableSort;
+		break;
 
 	case SortAlgorithms::RADIX_SORT:
+		//	keys that can not be broken into digits fall through to bogusSort
+		if constexpr (RadixSort::is_radix_sortable<T>) {
+			sort = RadixSort::sort;
+		} else {
+			sort = bogusSort;
+		}
+		break;
+
 	case SortAlgorithms::COUNTING_SORT:
+		sort = CountingSort::sort;
+		break;
+
 	default:
 		sort = bogusSort;
 		break;
 	}
 
-	T previous[array_size];
 	bool permutations_done = false;
 	for (num_repetitions_t i = 0;
 						   i < num_repetitions && !permutations_done;
@@ -201,7 +284,16 @@ OneTestResult<T>* testOneAlgorithm(	SortAlgorithms& algorithm,
 		}
 		SortMetrics compares_and_moves(0,0);
 //		printSideBySide(*reference_data, *sorted_data);
+		if (perf_counters) perf_counters->start();
+		//	CountingKeys count themselves, by the same rules for every sort,
+		//	  on whichever thread, including the workers of parallel sorts
+		if constexpr (is_counting_key<T>) ThreadMetrics::resetAllThreads();
+		uint64_t start_time = readSortClock(clock);
 		sort(sorted_data, array_size, &compares_and_moves);
+		uint64_t end_time	= readSortClock(clock);
+		if constexpr (is_counting_key<T>) compares_and_moves = ThreadMetrics::allThreads();
+		if (perf_counters) retval->m_perf_counts += perf_counters->stop();
+		retval->m_sort_metrics.addTime(static_cast<double>(end_time - start_time));
 //		printSideBySide(*reference_data, *sorted_data);
 //		std::cout << "evaluating success of repetition " << i << std::endl;
 
@@ -242,6 +334,15 @@ OneTestResult<T>* testOneAlgorithm(	SortAlgorithms& algorithm,
 		}
 		delete result;
 	}
+	//	The memory is measured by sorting the last input again, after the
+	//	  timed sorts, so that filling the stack & counting allocations
+	//	  are not part of the times
+	if (count_aux_memory) {
+		copy_array(sorted_data, previous);
+		MemoryAccounting::start();
+		sort(sorted_data, array_size, nullptr);
+		retval->m_aux_memory += MemoryAccounting::stop();
+	}
 SORT_TEST_ONE_ALGORITHM_RETURN_LABEL:
 	if (permutation_generator) {
 		delete permutation_generator;
@@ -11,6 +11,9 @@
 #include <climits>
 #include <limits>
 #include <inttypes.h>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
 
 #include "OStreamState.h"
 #include "SortTestMetrics.h"
@@ -118,6 +121,8 @@ SortTestMetrics::SortTestMetrics(const SortTestMetrics &other) {
 	assignments 	= other.assignments;
 	num_repetitions = other.num_repetitions;
 	is_stable		= other.is_stable;
+	clock			= other.clock;
+	times			= other.times;
 }
 
 SortTestMetrics& SortTestMetrics::operator=(const SortTestMetrics& other) {
@@ -126,6 +131,8 @@ SortTestMetrics& SortTestMetrics::operator=(const SortTestMetrics& other) {
 		compares 		= other.compares;
 		assignments 	= other.assignments;
 		num_repetitions = other.num_repetitions;
+		clock			= other.clock;
+		times			= other.times;
 		//	do not overwrite 'is_stable' if a previous operation has
 		//	determined that the algorithm was not stable
 		//	- i.e, 'is_stable' is sticky once false
@@ -140,3 +147,154 @@ SortTestMetrics& SortTestMetrics::operator+=(const SortMetrics &object) {
 	assignments	+= object.assignments;
 	return *this;
 }
+
+void SortTestMetrics::addTime(double time) {
+	times.push_back(time);
+}
+
+double SortTestMetrics::minTime(void) const {
+
+	if (times.empty()) {
+		return 0.0;
+	}
+	return *std::min_element(times.begin(), times.end());
+}
+
+double SortTestMetrics::medianTime(void) const {
+
+	if (times.empty()) {
+		return 0.0;
+	}
+	std::vector<double> sorted_times(times);
+	std::sort(sorted_times.begin(), sorted_times.end());
+	size_t middle = sorted_times.size() / 2;
+	if (sorted_times.size() % 2) {
+		return sorted_times[middle];
+	}
+	return (sorted_times[middle-1] + sorted_times[middle]) / 2.0;
+}
+
+double SortTestMetrics::meanTime(void) const {
+
+	if (times.empty()) {
+		return 0.0;
+	}
+	double sum = 0.0;
+	for (double time : times) {
+		sum += time;
+	}
+	return sum / times.size();
+}
+
+/*
+ * 	Nearest rank:  the smallest time that is at least as long as
+ * 	'percent' of the times.  With 100 repetitions, p99 is the second
+ * 	longest time and p90 is the eleventh longest.
+ */
+
+double SortTestMetrics::percentileTime(double percent) const {
+
+	if (times.empty()) {
+		return 0.0;
+	}
+	std::vector<double> sorted_times(times);
+	std::sort(sorted_times.begin(), sorted_times.end());
+	size_t rank = static_cast<size_t>(std::ceil(percent / 100.0 * sorted_times.size()));
+	if (rank < 1) {
+		rank = 1;
+	}
+	if (rank > sorted_times.size()) {
+		rank = sorted_times.size();
+	}
+	return sorted_times[rank-1];
+}
+
+std::string SortTestMetrics::time_str(double time) const {
+
+	OStreamState ostream_state;		// restores flags in its destructor
+
+	std::stringstream retval;
+
+	retval << std::fixed << std::setprecision(0) << time;
+
+	return retval.str();
+}
+
+const char* SortTestMetrics::timeUnits(void) const {
+
+	switch (clock) {
+	case SortClock::TIME_STAMP_COUNTER:
+		return SORT_CLOCK_TIME_STAMP_COUNTER_UNITS;
+	case SortClock::STEADY_CLOCK:
+	default:
+		return SORT_CLOCK_STEADY_CLOCK_UNITS;
+	}
+}
+
+/*	**************************************************************	*/
+/*						ThreadMetrics' threads						*/
+/*	**************************************************************	*/
+
+/*
+ * 	The counters of the running threads are kept in a fixed table, so
+ * 	that registering a thread never allocates, which MemoryAccounting
+ * 	would count, and the table is never destroyed before a thread that
+ * 	ends during exit, such as a pool worker.  When a thread ends its
+ * 	counts are added to the retired counts.  A thread that finds the
+ * 	table full is not seen by allThreads().
+ */
+
+namespace {
+	constexpr int max_counted_threads = 256;
+
+	std::atomic<compares_t*>	s_thread_counts[max_counted_threads];
+	std::atomic<compares_t>		s_retired_counts[2];
+}
+
+void ThreadMetrics::registerThread(compares_t *counts) {
+
+	for (auto &slot : s_thread_counts) {
+		compares_t *empty = nullptr;
+		if (slot.compare_exchange_strong(empty, counts)) {
+			return;
+		}
+	}
+}
+
+void ThreadMetrics::unregisterThread(compares_t *counts) {
+
+	for (auto &slot : s_thread_counts) {
+		if (slot.load() == counts) {
+			s_retired_counts[0] += counts[0];
+			s_retired_counts[1] += counts[1];
+			slot = nullptr;
+			return;
+		}
+	}
+}
+
+SortMetrics ThreadMetrics::allThreads(void) {
+
+	SortMetrics retval(s_retired_counts[0].load(), s_retired_counts[1].load());
+	for (auto &slot : s_thread_counts) {
+		compares_t *counts = slot.load();
+		if (counts) {
+			retval.compares 	+= counts[0];
+			retval.assignments 	+= counts[1];
+		}
+	}
+	return retval;
+}
+
+void ThreadMetrics::resetAllThreads(void) {
+
+	s_retired_counts[0] = 0;
+	s_retired_counts[1] = 0;
+	for (auto &slot : s_thread_counts) {
+		compares_t *counts = slot.load();
+		if (counts) {
+			counts[0] = 0;
+			counts[1] = 0;
+		}
+	}
+}
@@ -13,6 +13,13 @@
 #include <ios>
 #include <inttypes.h>
 #include <climits>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
 
 #include "OStreamState.h"
 
@@ -90,6 +97,148 @@ public:
 	}
 };
 
+/*
+ * 	The sorts take the type of their metrics pointer as a template
+ * 	parameter, which defaults to SortMetrics.  The algorithms count with
+ * 	'if (metrics) metrics->compares++', and the type decides what that
+ * 	costs:
+ *
+ * 	SortMetrics		-	counts into the object, as the test bench needs
+ * 	NoMetrics		-	its counters ignore what they are given, so the
+ * 						statement has no effect & the compiler removes it,
+ * 						test and all.  sort<T, NoMetrics>(array, size)
+ * 						is the uninstrumented sort.  That is not always
+ * 						faster: without the counts a branch may become a
+ * 						conditional move, as in HeapSort::sinkNodeBottomUp(),
+ * 						which then waits for each load on large arrays
+ * 	ThreadMetrics	-	counts into the calling thread's counters, so one
+ * 						ThreadMetrics can be shared by code on many threads
+ * 						without the threads sharing a line
+ *
+ * 	A parallel sort gives each worker its own WorkerMetrics<Metrics> and
+ * 	adds them to 'metrics' when the workers are done.  For ThreadMetrics
+ * 	those are SortMetrics, which are added to the caller's counters, so
+ * 	ThreadMetrics::thisThread() includes the work of the workers.
+ */
+
+//	A counter that ignores what it is given
+class NoCount {
+public:
+	NoCount& operator++(int)					{	return *this;	}
+	template <typename N>
+	NoCount& operator+=(const N&)				{	return *this;	}
+};
+
+class NoMetrics {
+public:
+	NoCount	compares;
+	NoCount	assignments;
+
+	NoMetrics& operator+=(const NoMetrics&)		{	return *this;	}
+
+	friend std::ostream& operator<<(std::ostream& out, NoMetrics&) {
+		return out << "not counted";
+	}
+};
+
+class ThreadMetrics {
+public:
+	//	Adds to one of the calling thread's counters
+	class Counter {
+	public:
+		explicit Counter(int which) : m_which(which) {}
+		Counter& operator++(int) 				{	counts()[m_which]++;	return *this;	}
+		template <typename N>
+		Counter& operator+=(const N& n)			{	counts()[m_which] += n;	return *this;	}
+	private:
+		int m_which;
+	};
+
+	Counter	compares{0};
+	Counter	assignments{1};
+
+	//	Adds counts kept elsewhere, such as by a worker, to the calling thread's
+	ThreadMetrics& operator+=(const SortMetrics &other) {
+		counts()[0] += other.compares;
+		counts()[1] += other.assignments;
+		return *this;
+	}
+
+	//	What the calling thread has counted since it last called reset()
+	static SortMetrics thisThread(void) {
+		return SortMetrics(counts()[0], counts()[1]);
+	}
+	static void reset(void) {
+		counts()[0] = 0;
+		counts()[1] = 0;
+	}
+
+	//	What every thread, including threads that have ended, has counted
+	//	  since resetAllThreads().  The other threads' counters are read &
+	//	  written without locks, so call these only while no other thread
+	//	  is counting, such as before & after a parallel sort
+	static SortMetrics allThreads(void);
+	static void resetAllThreads(void);
+
+	friend std::ostream& operator<<(std::ostream& out, ThreadMetrics&) {
+		SortMetrics counts = thisThread();
+		return out << counts;
+	}
+
+private:
+	//	A thread's counters, which allThreads() can find while the thread runs
+	struct ThreadCounts {
+		compares_t counts[2] = { 0, 0 };
+		ThreadCounts()	{	registerThread(counts);		}
+		~ThreadCounts()	{	unregisterThread(counts);	}
+	};
+	static void registerThread(compares_t *counts);
+	static void unregisterThread(compares_t *counts);
+
+	static compares_t* counts(void) {
+		thread_local ThreadCounts thread_counts;
+		return thread_counts.counts;
+	}
+};
+
+//	What each worker of a parallel sort counts into
+template <typename Metrics>
+struct WorkerMetricsOf				{	using type = Metrics;		};
+
+template <>
+struct WorkerMetricsOf<ThreadMetrics>	{	using type = SortMetrics;	};
+
+template <typename Metrics>
+using WorkerMetrics = typename WorkerMetricsOf<Metrics>::type;
+
+
+//	The clock that each repetition of a sort is timed with
+enum class SortClock {
+	STEADY_CLOCK,			// std::chrono::steady_clock, in nanoseconds
+	TIME_STAMP_COUNTER,		// rdtsc, in ticks of the time stamp counter
+};
+#define SORT_CLOCK_STEADY_CLOCK_UNITS			"ns"
+#define SORT_CLOCK_TIME_STAMP_COUNTER_UNITS		"ticks"
+
+//	The time stamp counter is only read on x86
+inline bool isAvailable([[maybe_unused]] SortClock clock) {
+#if defined(__x86_64__) || defined(__i386__)
+	return true;
+#else
+	return clock != SortClock::TIME_STAMP_COUNTER;
+#endif
+}
+
+//	The time now, in the units of 'clock'.  Subtract two readings
+inline uint64_t readSortClock(SortClock clock) {
+#if defined(__x86_64__) || defined(__i386__)
+	if (clock == SortClock::TIME_STAMP_COUNTER) {
+		return __rdtsc();
+	}
+#endif
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now().time_since_epoch()).count();
+}
 
 //	This keeps track of the cumulative performance of many runs of a sort
 class	SortTestMetrics {
@@ -98,6 +247,8 @@ public:
 	total_moves_t 		assignments;		// public so that ++ operator works
 	num_repetitions_t 	num_repetitions;
 	bool				is_stable;			// defaults to true
+	SortClock			clock;				// the units of 'times'
+	std::vector<double>	times;				// one per repetition
 
 	double averageCompares(void) const;
 	double averageAssignments(void) const;
@@ -107,10 +258,20 @@ public:
 	std::string compares_str(void) const;
 	std::string assignments_str(void) const;	// just the number
 
+	void addTime(double time);
+	double minTime(void) const;
+	double medianTime(void) const;
+	double meanTime(void) const;
+	//	The time that 'percent' of the repetitions took no longer than
+	double percentileTime(double percent) const;
+	std::string time_str(double time) const;	// just the number
+	const char* timeUnits(void) const;
+
 	SortTestMetrics() { compares 		= 0;
 					  	assignments 	= 0;
 					  	num_repetitions = 0;
-					  	is_stable 		= true;}
+					  	is_stable 		= true;
+					  	clock			= SortClock::STEADY_CLOCK;}
 
 	~SortTestMetrics() {}
 	SortTestMetrics(total_compares_t 	_compares,
@@ -120,7 +281,8 @@ public:
 					  compares(_compares),
 					  assignments(_moves),
 					  num_repetitions(_num_repetitions),
-					  is_stable(_is_stable) {}
+					  is_stable(_is_stable),
+					  clock(SortClock::STEADY_CLOCK) {}
 
 	SortTestMetrics(const SortTestMetrics &other);
 	SortTestMetrics& operator=(const SortTestMetrics &other);
@@ -0,0 +1,187 @@
+/*
+ * SortingNetworks.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Joe Baker
+ */
+
+#ifndef SORTINGNETWORKS_H_
+#define SORTINGNETWORKS_H_
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "SortingDataTypes.h"
+#include "InsertionSort.h"
+
+/*
+ * 	Sorting networks for 2 to 32 elements, generated at compile time
+ * 	with the Bose-Nelson algorithm.  The network for each size is a fixed
+ * 	list of compare-exchanges, which is expanded into straight line code,
+ * 	so every index is a constant and there are no loops.
+ *
+ * 	For arithmetic types, a compare-exchange is written as a min and a
+ * 	max, which the compiler turns into conditional moves, so sorting a
+ * 	small span has no unpredictable branches.  For other types it is a
+ * 	compare and a swap if they are out of order.
+ *
+ * 	A network is not stable.
+ */
+
+namespace SortingNetworks {
+
+	//	The largest span that has a network
+	constexpr array_size_t max_size = 32;
+
+	//	Sorts that special case tiny spans use a network up to this size.
+	//	  Only arithmetic types are branch free, so other types keep
+	//	  the network for 2 elements, which is a single compare & swap
+	template <typename T>
+	constexpr array_size_t max_span_for_network = std::is_arithmetic<T>::value ? 16 : 2;
+
+	//	Bose-Nelson needs 211 compare-exchanges for 32 elements
+	constexpr int max_comparators = 256;
+
+	struct Comparator {
+		int i = 0;
+		int j = 0;
+	};
+
+	/*
+	 * 	Bose & Nelson, "A Sorting Problem", JACM 1962.  star() sorts 'm'
+	 * 	elements by sorting each half and merging them with bracket(),
+	 * 	which merges the sorted spans [i:i+x-1] and [j:j+y-1].
+	 */
+
+	struct NetworkBuilder {
+		Comparator	comparators[max_comparators] = {};
+		int			size = 0;
+
+		constexpr void add(int i, int j) {
+			comparators[size].i = i;
+			comparators[size].j = j;
+			size++;
+		}
+
+		constexpr void bracket(int i, int x, int j, int y) {
+			if (x == 1 && y == 1) {
+				add(i, j);
+			} else if (x == 1 && y == 2) {
+				add(i, j+1);
+				add(i, j);
+			} else if (x == 2 && y == 1) {
+				add(i, j);
+				add(i+1, j);
+			} else {
+				int a = x/2;
+				int b = (x & 1) ? y/2 : (y+1)/2;
+				bracket(i, a, j, b);
+				bracket(i+a, x-a, j+b, y-b);
+				bracket(i+a, x-a, j, b);
+			}
+		}
+
+		constexpr void star(int i, int m) {
+			if (m > 1) {
+				int a = m/2;
+				star(i, a);
+				star(i+a, m-a);
+				bracket(i, a, i+a, m-a);
+			}
+		}
+	};
+
+	template <int N>
+	constexpr NetworkBuilder buildNetwork() {
+		NetworkBuilder builder;
+		builder.star(0, N);
+		return builder;
+	}
+
+	template <int N>
+	struct Network {
+		static constexpr NetworkBuilder network = buildNetwork<N>();
+		static constexpr int			size	= network.size;
+		static_assert(size <= max_comparators, "sorting network is too large");
+	};
+
+	/*	**********************************************************	*/
+	/*						function declarations					*/
+	/*	**********************************************************	*/
+
+	// Declare the functions with default parameter for SortMetrics*
+	template <typename T, typename Metrics = SortMetrics>
+	void sort(T* array, array_size_t size, Metrics *metrics = nullptr);
+
+	//	Sorts exactly N elements
+	template <int N, typename T, typename Metrics = SortMetrics>
+	void sortFixed(T* array, Metrics *metrics = nullptr);
+
+	//	Puts the lesser of 'a' & 'b' in 'a'
+	template <typename T, typename Metrics = SortMetrics>
+	void compareExchange(T& a, T& b, Metrics *metrics = nullptr);
+
+
+	/*	**********************************************************	*/
+	/*						function definitions					*/
+	/*	**********************************************************	*/
+
+	template <int N, typename T, typename Metrics, std::size_t... C>
+	void applyNetwork(T* array, Metrics *metrics, std::index_sequence<C...>) {
+
+		(compareExchange(array[Network<N>::network.comparators[C].i],
+						 array[Network<N>::network.comparators[C].j], metrics), ...);
+	}
+
+	template <int N, typename T, typename Metrics>
+	void sortFixed(T* array, Metrics *metrics) {
+
+		applyNetwork<N>(array, metrics, std::make_index_sequence<Network<N>::size>());
+	}
+
+	//	networks[i] sorts i+2 elements.  0 & 1 elements need no network
+	template <typename T, typename Metrics, std::size_t... N>
+	void sortBySize(T* array, array_size_t size, Metrics *metrics,
+					std::index_sequence<N...>) {
+
+		using SortFixedFunction = void (*)(T*, Metrics*);
+		static constexpr SortFixedFunction networks[] = { &sortFixed<N+2, T, Metrics>... };
+		networks[size-2](array, metrics);
+	}
+
+	template <typename T, typename Metrics>
+	void sort(T* array, array_size_t size, Metrics *metrics) {
+
+		if (size <= 1)
+			return;
+
+		if (size > max_size) {
+			InsertionSort::sort(array, size, metrics);
+			return;
+		}
+		sortBySize(array, size, metrics, std::make_index_sequence<max_size-1>());
+	}
+
+	template <typename T, typename Metrics>
+	void compareExchange(T& a, T& b, Metrics *metrics) {
+
+		if (metrics) metrics->compares++;
+		if constexpr (std::is_arithmetic<T>::value) {
+			if (metrics) metrics->assignments += 2;
+			T lesser  = b < a ? b : a;
+			T greater = b < a ? a : b;
+			a = lesser;
+			b = greater;
+		} else {
+			if (a > b) {
+				if (metrics) metrics->assignments += 3;
+				T tmp = a;
+				a = b;
+				b = tmp;
+			}
+		}
+	}
+}
+
+#endif /* SORTINGNETWORKS_H_ */
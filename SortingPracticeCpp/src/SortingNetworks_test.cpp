@@ -0,0 +1,65 @@
+/*
+ * SortingNetworks_test.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Joe Baker
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <cstdint>
+
+#include "SortingNetworks.h"
+
+/*
+ * 	By the 0-1 principle, a network that sorts every array of 0s and 1s
+ * 	sorts every array.  Networks of up to 'max_exhaustive_size' elements
+ * 	are tested with all 2^n arrays of 0s and 1s, and the larger ones with
+ * 	pseudo random arrays of 0s and 1s.
+ */
+
+bool testSortingNetworks() {
+
+	constexpr int 		max_exhaustive_size = 20;
+	constexpr uint32_t	num_random_arrays	= 1 << 16;
+
+	int 	 array[SortingNetworks::max_size];
+	uint64_t state = 0x9E3779B97F4A7C15ull;
+
+	for (int size = 2; size <= SortingNetworks::max_size; size++) {
+
+		bool exhaustive = size <= max_exhaustive_size;
+		uint64_t num_arrays = exhaustive ? (uint64_t(1) << size) : num_random_arrays;
+
+		for (uint64_t n = 0; n != num_arrays; n++) {
+			uint64_t bits = n;
+			if (!exhaustive) {
+				// xorshift64
+				state ^= state << 13;
+				state ^= state >> 7;
+				state ^= state << 17;
+				bits = state;
+			}
+			int num_ones = 0;
+			for (int i = 0; i != size; i++) {
+				array[i] = (bits >> i) & 1;
+				num_ones += array[i];
+			}
+
+			SortingNetworks::sort(array, size);
+
+			for (int i = 0; i != size; i++) {
+				if (array[i] != (i >= size - num_ones ? 1 : 0)) {
+					std::cout << "ERROR: the network for " << size
+							  << " elements did not sort 0x" << std::hex << bits
+							  << std::dec << std::endl;
+					return false;
+				}
+			}
+		}
+		std::cout << "The network for " << std::setw(2) << size << " elements sorted "
+				  << num_arrays << (exhaustive ? " (all) " : " random ")
+				  << "arrays of 0s and 1s\n";
+	}
+	return true;
+}
@@ -10,10 +10,14 @@
 #include <iomanip>
 #include <memory>
 #include <string>
+#include <type_traits>
 
+#include "CountingKey.h"
+#include "PerfCounters.h"
 #include "SortTest.h"
 #include "ResultOutput.h"
 #include "TestFixtures.h"
+#include "WorkStealingPool.h"
 
 /*	******************************************************************************	*/
 /*	******************************************************************************	*/
@@ -34,6 +38,8 @@ int main(int argc, char *argv[])
 //	testBlockSort();
 //	return EXIT_SUCCESS;
 //	sortingDataTypesTest();
+//	return EXIT_SUCCESS;
+//	testSimdSortingNetwork();
 //	return EXIT_SUCCESS;
 
 	//	Ensure that if the user selects 'All_PERMUTATIONS', they are
@@ -78,6 +84,13 @@ int main(int argc, char *argv[])
 		}
 	};
 
+	//	Count compares & assignments with CountingKeys, which count every sort,
+	//	  std::sort included, by the same rules, instead of each sort's own counts.
+	//	  The counting is timed along with the sort
+	constexpr bool count_with_keys = false;
+	using TestType = std::conditional_t<count_with_keys,
+										CountingKey<DataType>, SortingDataType<DataType>>;
+
 //	array_size_t array_sizes[]	= { 64, 128, 256, 512 };
 	array_size_t array_sizes[] 	= { 128, 256, 512 };
 	int num_array_sizes 	 	= sizeof(array_sizes) / sizeof(array_size_t);
@@ -88,11 +101,27 @@ int main(int argc, char *argv[])
 			SortAlgorithms::INSERTION_SORT,
 			SortAlgorithms::DUTCH_FLAG_SORT,
 			SortAlgorithms::HEAP_SORT,
+			SortAlgorithms::BOTTOM_UP_HEAP_SORT,
+			SortAlgorithms::D_ARY_HEAP_SORT,
+			SortAlgorithms::SMOOTH_SORT,
 			SortAlgorithms::QUICK_SORT,
 			SortAlgorithms::PROTECTED_QUICK_SORT,
+			SortAlgorithms::INTRO_SORT,
+			SortAlgorithms::PATTERN_DEFEATING_QUICK_SORT,
+			SortAlgorithms::BLOCK_QUICK_SORT,
+			SortAlgorithms::DUAL_PIVOT_QUICK_SORT,
+			SortAlgorithms::PARALLEL_QUICK_SORT,
 			SortAlgorithms::MERGE_SORT,
+			SortAlgorithms::PARALLEL_MERGE_SORT,
+			SortAlgorithms::TIM_SORT,
+			SortAlgorithms::POWER_SORT,
+			SortAlgorithms::RADIX_SORT,
+			SortAlgorithms::COUNTING_SORT,
 //			SortAlgorithms::INPLACE_MERGE,
 //			SortAlgorithms::BLOCK_SORT,
+			SortAlgorithms::BLOCK_SORT_INTERNAL_BUFFER,
+			SortAlgorithms::STD_SORT,
+			SortAlgorithms::STD_STABLE_SORT,
 	};
 	int num_sort_algorithms = sizeof(sort_algorithms)/sizeof(SortAlgorithms);
 
@@ -127,7 +156,7 @@ int main(int argc, char *argv[])
 	int num_initial_orderings = sizeof(initial_orderings)/sizeof(InitialOrdering);
 
 	int num_results = num_array_sizes * num_sort_algorithms * num_compositions * num_initial_orderings;
-	OneTestResult<SortingDataType<DataType>>* results[num_results];
+	OneTestResult<TestType>* results[num_results];
 
 	/*
 	 * 	The randomizer is a pseudo-random sequence generator that is
@@ -146,6 +175,29 @@ int main(int argc, char *argv[])
 
 	int num_repetitions = 100;
 
+	//	Read the processor's performance counters around each sort, if perf allows it
+	constexpr bool count_perf_events = true;
+	PerfCounters perf_counters;
+	if (count_perf_events && !perf_counters.isAvailable()) {
+		std::cout << "Performance counters are not available, "
+				  << "check /proc/sys/kernel/perf_event_paranoid" << std::endl;
+	}
+	if (count_with_keys) {
+		std::cout << "Compares & assignments are counted by CountingKey" << std::endl;
+	}
+	//	Count the heap, arena & stack each sort uses, in one more sort
+	//	  after the timed ones
+	constexpr bool count_aux_memory = true;
+	if (count_aux_memory) {
+		//	The shared pool is created on first use, which would be
+		//	  counted as memory used by the first parallel sort
+		WorkStealingPool::shared();
+		if (!MemoryAccounting::counts_heap) {
+			std::cout << "Heap allocations are not counted, "
+					  << "build with MEMORY_ACCOUNTING_HEAP defined to count them" << std::endl;
+		}
+	}
+
 	std::cout 	<< "Algorithms: " << num_sort_algorithms
 				<< " Compositions: " << num_compositions
 				<< " Orderings: " << num_initial_orderings
@@ -166,21 +218,26 @@ int main(int argc, char *argv[])
 					if (!confirm_permutation_size(composition.composition, array_size)) {
 						continue;
 					}
-					SortingDataType<DataType> test_values[array_size];
-					SortingUtilities::generateReferenceTestVector<SortingDataType<DataType>, DataType>(
+					std::unique_ptr<TestType[]> test_storage(new TestType[array_size]);
+					TestType *test_values = test_storage.get();
+					SortingUtilities::generateReferenceTestVector<TestType, DataType>(
 							test_values, array_size,
 							composition,
 							first_value, last_value,
 							next_value);
 
-					results[cnt] = testOneAlgorithm<SortingDataType<DataType>>(
+					results[cnt] = testOneAlgorithm<TestType>(
 							sort_algorithms[algorithm_i],
 							composition,
 							initial_orderings[ordering_i],
 							randomizer,
 							test_values,
 							array_size,
-							num_repetitions);
+							num_repetitions,
+							SortClock::STEADY_CLOCK,
+							count_perf_events && perf_counters.isAvailable() ?
+								&perf_counters : nullptr,
+							count_aux_memory);
 
 					if (!results[cnt]->m_failure_log->m_diagnostics.is_sorted) {
 							std::cout << "Sort failed: ";
@@ -11,6 +11,7 @@
 #include "SimpleRandomizer.h"
 #include "OStreamState.h"
 #include "SortingDebugOutput.h"
+#include "Rotation.h"
 
 #pragma push_macro("_verbose")
 //#undef _verbose
@@ -30,21 +31,38 @@ namespace SortingUtilities {
 
 	/*	Returns the index of the first element that is greater than 'value'
 	 * 	This is used to insert a value to the right of it's peers	*/
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	array_size_t binarySearchLastElement(T* array,
 										 array_size_t range_start,
 										 array_size_t range_end,
 										 T& value,
-										 SortMetrics *metrics = nullptr);
+										 Metrics *metrics = nullptr);
 
 	/*	Returns the index of the first element that is equal to or greater than 'value'
 	 * 	This is used to insert a value to the left of it's peers	*/
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	array_size_t binarySearchFirstElement(T* array,
 										  array_size_t range_start,
 										  array_size_t range_end,
 										  T& value,
-										  SortMetrics *metrics = nullptr);
+										  Metrics *metrics = nullptr);
+
+	/*	Returns the same index as binarySearchFirstElement, or as
+	 * 	binarySearchLastElement if 'past_equal', but probes exponentially
+	 * 	from range_start (or range_end if 'from_right') first, so it costs
+	 * 	about 2*log(distance) compares when the answer is near that end	*/
+	template <typename T, typename Metrics = SortMetrics>
+	array_size_t gallopingSearch(T* array,
+								 array_size_t range_start,
+								 array_size_t range_end,
+								 T& value,
+								 bool from_right,
+								 bool past_equal,
+								 Metrics *metrics = nullptr);
+
+	//	The number of elements in a row that a merge takes from one side
+	//	  before it stops comparing one element at a time and gallops
+	constexpr array_size_t gallop_threshold = 7;
 
 	// 'hide' this in the namespace to try to prevent collisions with
 	//	possible functions with identical signatures in other namespaces
@@ -53,8 +71,8 @@ namespace SortingUtilities {
 	//	This can be used by a sorting algorithm to determine if a cutoff
 	//	to insertion sort should occur.  Since it can be used as part of
 	//  an algorithm, it can be passed 'metics'
-	template <typename T>
-	bool isSorted(T *array, array_size_t size, SortMetrics *metrics = nullptr);
+	template <typename T, typename Metrics = SortMetrics>
+	bool isSorted(T *array, array_size_t size, Metrics *metrics = nullptr);
 
 	// returns bool
 	// stores number of compares in 'metrics'
@@ -68,31 +86,31 @@ namespace SortingUtilities {
 
 	/*	Some algorithms like QuickSort use this to ensure the array is not
 	 *	 in reverse order, which might otherwise lead to n^2 performance */
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	void randomizeArray(T* array, array_size_t size,
-						SortMetrics *metrics = nullptr);
+						Metrics *metrics = nullptr);
 
 	/*	rotates elements of an array [start:end] an amount, where negative
 	 * values of 'amount' indicate to rotate the span to the left.
 	 * Blocks must be adjacent / contiguous	*/
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	void rotateArrayElementsRight(T* array,
 								  array_size_t block_1_start,
 								  array_size_t block_2_end,
 							 	  array_size_t amount,
-								  SortMetrics *metrics = nullptr);
+								  Metrics *metrics = nullptr);
 
 	/*	This is used in all of the QuickSort based algorithms	*/
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	void selectAndPositionPivot(T* array,
 								array_size_t start,
 								array_size_t end,
-								SortMetrics *metrics = nullptr);
+								Metrics *metrics = nullptr);
 
 	//	This improves understanding & readability in swap-based algorithms
-	template <typename T>
+	template <typename T, typename Metrics = SortMetrics>
 	void swap(T*array, array_size_t i, array_size_t j,
-			  SortMetrics *metrics = nullptr);
+			  Metrics *metrics = nullptr);
 
 
 	/*	**********************************************************************	*/
@@ -116,12 +134,12 @@ namespace SortingUtilities {
 	 *	{ 0, 0, 1, 1, 2, 2 }	binaryFirst(array, 0, 5, &3) returns 6
 	 */
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	array_size_t binarySearchFirstElement(T* array,
 										  array_size_t range_start,
 										  array_size_t range_end,
 										  T& value,
-										  SortMetrics *metrics) {
+										  Metrics *metrics) {
 
 		array_size_t start 	= range_start;
 		array_size_t end	= range_end;
@@ -166,12 +184,12 @@ namespace SortingUtilities {
 	 *	{ 0, 0, 1, 1, 2, 2 }	binaryLast(array, 0, 5, &3) returns 6
 	 */
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	array_size_t binarySearchLastElement(T* array,
 										 array_size_t range_start,
 										 array_size_t range_end,
 										 T& value,
-										 SortMetrics *metrics) {
+										 Metrics *metrics) {
 
 		array_size_t start 	= range_start;
 		array_size_t end	= range_end;
@@ -201,6 +219,75 @@ namespace SortingUtilities {
 	}
 
 
+	/*
+	 * 	gallopingSearch(array, first, last, value, from_right, past_equal)
+	 *
+	 * 	Probes [first], [first+1], [first+3], [first+7], ... until it passes
+	 * 	'value', then binary searches the last interval.  'from_right' probes
+	 * 	[last], [last-1], [last-3], ... instead.  A merge that has taken many
+	 * 	elements in a row from one side expects the next change of side to
+	 * 	be far away, but not as far as the end of the block.
+	 *
+	 *	  0  1  2  3  4  5
+	 *	{ 0, 0, 1, 1, 2, 2 }	galloping(array, 0, 5, &1, false, false) returns 2
+	 *	{ 0, 0, 1, 1, 2, 2 }	galloping(array, 0, 5, &1, true,  true)  returns 4
+	 */
+
+	template <typename T, typename Metrics>
+	array_size_t gallopingSearch(T* array,
+								 array_size_t range_start,
+								 array_size_t range_end,
+								 T& value,
+								 bool from_right,
+								 bool past_equal,
+								 Metrics *metrics) {
+
+		if (range_end < range_start)
+			return range_start;
+
+		// true if the element at [i] goes before 'value'
+		auto goes_before = [&](array_size_t i) {
+			if (metrics) metrics->compares++;
+			return past_equal ? !(value < array[i]) : array[i] < value;
+		};
+
+		// the index being searched for is in [lo:hi]
+		array_size_t lo 	= range_start;
+		array_size_t hi 	= range_end+1;
+		array_size_t step	= 1;
+
+		if (!from_right) {
+			array_size_t probe = range_start;
+			while (probe <= range_end && goes_before(probe)) {
+				lo 	  = probe+1;
+				step *= 2;
+				probe = range_start + step-1;
+			}
+			if (probe < hi) {
+				hi = probe;
+			}
+		} else {
+			array_size_t probe = range_end;
+			while (probe >= range_start && !goes_before(probe)) {
+				hi	  = probe;
+				step *= 2;
+				probe = range_end+1 - step;
+			}
+			if (probe >= lo) {
+				lo = probe+1;
+			}
+		}
+
+		if (lo == hi) {
+			return lo;
+		}
+		if (past_equal) {
+			return binarySearchLastElement(array, lo, hi-1, value, metrics);
+		}
+		return binarySearchFirstElement(array, lo, hi-1, value, metrics);
+	}
+
+
 	/*
 	 * 	bool isSorted(array, size, metrics);
 	 *
@@ -209,8 +296,8 @@ namespace SortingUtilities {
 	 *	complexity of this, which is added to the complexity of the sort
 	 */
 
-	template <typename T>
-	bool isSorted(T *array, array_size_t size, SortMetrics *metrics)
+	template <typename T, typename Metrics>
+	bool isSorted(T *array, array_size_t size, Metrics *metrics)
 	{
 		for (array_size_t i = size-1; i > 0 ; --i) {
 			if (metrics) metrics->compares++;
@@ -261,8 +348,8 @@ namespace SortingUtilities {
 	 * sort algorithm, metrics are tallied
 	 */
 
-	template <typename T>
-	void randomizeArray(T* array, array_size_t size, SortMetrics *metrics) {
+	template <typename T, typename Metrics>
+	void randomizeArray(T* array, array_size_t size, Metrics *metrics) {
 
 		if (size <= 1)
 			return;
@@ -287,29 +374,28 @@ namespace SortingUtilities {
 	 * 	rotate the contents of the array by 'amount' positions
 	 * 	  where the array is defined as array[start]:array[end] (inclusive)
 	 *
-	 * 	algorithm:
 	 * 		consider amount to rotate = 3
 	 * 		array									{ A, B, C, D, E, F, G }
-	 * 		reverse the array						{ G, F, E, D, C, B, A }
-	 * 		reverse the sub array [start:amount-1]  { E, F, G  D, C, B, A }
-	 * 		reverse the sub array [amount:end]		{ E, F, G, A, B, C, D }
+	 * 		rotated									{ E, F, G, A, B, C, D }
+	 *
+	 * 	The rotation is done by Rotation::rotate(), which picks the kernel
 	 *
 	 * 	note that amount can be negative (left) or greater than the span
 	 * 		negative amounts are converted into the equivalent positive amount
 	 * 		amounts greater than the span are modulo-division to be within the span
 	 */
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	void rotateArrayElementsRight(T* array,
 								  array_size_t span_start,
 								  array_size_t span_end,
 								  array_size_t amount,
-								  SortMetrics *metrics) {
+								  Metrics *metrics) {
 
-		array_size_t span = span_end-span_start;
+		array_size_t span = span_end-span_start+1;
 
 		//	qualify all of the block indices
-		if (span <= 0)
+		if (span <= 1)
 			return;
 
 		//	converts amounts that are not in [0,span) to in range
@@ -317,20 +403,8 @@ namespace SortingUtilities {
 		if (amount == 0)
 			return;
 
-		//	reverse the entire array
-		for (array_size_t i = span_start, j = span_end; i < j; i++, j--) {
-			SortingUtilities::swap(array, i, j, metrics);
-		}
-
-		//	reverse the left hand side
-		for (array_size_t i = span_start, j = span_start+amount-1; i < j; i++, j--) {
-			SortingUtilities::swap(array, i, j, metrics);
-		}
-
-		//	reverse the right hand side
-		for (array_size_t i = span_start + amount, j = span_end; i < j; i++, j--) {
-			SortingUtilities::swap(array, i, j, metrics);
-		}
+		//	the last 'amount' elements move to the front
+		Rotation::rotate(array, span_start, span-amount, amount, metrics);
 	}
 
 
@@ -343,9 +417,9 @@ namespace SortingUtilities {
 	 * 	into the [start] position for partitioning
 	 */
 
-	template <typename T>
+	template <typename T, typename Metrics>
 	void selectAndPositionPivot(T* array, array_size_t start, array_size_t end,
-								SortMetrics *metrics) {
+								Metrics *metrics) {
 
 		constexpr bool debug_verbose = false;
 
@@ -436,8 +510,8 @@ namespace SortingUtilities {
 	 * 	source code for sort algorithms that swap elements
 	 */
 
-	template <typename T>
-	void swap(T* array, array_size_t i, array_size_t j, SortMetrics *metrics) {
+	template <typename T, typename Metrics>
+	void swap(T* array, array_size_t i, array_size_t j, Metrics *metrics) {
 		T temp	 = array[i];
 		array[i] = array[j];
 		array[j] = temp;
@@ -0,0 +1,65 @@
+/*
+ * StdSort.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Joe Baker
+ *
+ *      The standard library's sorts, for comparison with the others
+ */
+
+#ifndef STDSORT_H_
+#define STDSORT_H_
+
+#include <algorithm>
+
+#include "SortingDataTypes.h"
+#include "SortTestMetrics.h"
+
+/*
+ * 	The compares are counted by the comparison that is passed to the
+ * 	library.  What the library moves can not be seen from here, so the
+ * 	assignments are only counted when the elements count themselves,
+ * 	as CountingKeys do.
+ */
+
+namespace StdSort {
+
+	/*	**************************************************************	*/
+	/*						function declarations						*/
+	/*	**************************************************************	*/
+
+	//	std::sort, an introsort
+	template <typename T, typename Metrics = SortMetrics>
+	void sort(T *array, array_size_t size, Metrics *metrics = nullptr);
+
+	//	std::stable_sort, a merge sort
+	template <typename T, typename Metrics = SortMetrics>
+	void stableSort(T *array, array_size_t size, Metrics *metrics = nullptr);
+
+
+	/*	**************************************************************	*/
+	/*						function definitions						*/
+	/*	**************************************************************	*/
+
+	template <typename T, typename Metrics>
+	void sort(T *array, array_size_t size, Metrics *metrics) {
+
+		std::sort(array, array + size,
+				  [metrics] (const T& u, const T& v) {
+					  if (metrics) metrics->compares++;
+					  return u < v;
+				  });
+	}
+
+	template <typename T, typename Metrics>
+	void stableSort(T *array, array_size_t size, Metrics *metrics) {
+
+		std::stable_sort(array, array + size,
+						 [metrics] (const T& u, const T& v) {
+							 if (metrics) metrics->compares++;
+							 return u < v;
+						 });
+	}
+}
+
+#endif /* STDSORT_H_ */
@@ -19,6 +19,7 @@
 
 bool testBlockSort();
 bool testPermuntationGenerator();
+bool testSimdSortingNetwork();
 
 
 #endif /* TESTFIXTURES_H_ */
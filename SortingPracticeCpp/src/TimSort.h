@@ -0,0 +1,331 @@
+/*
+ * TimSort.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Joe Baker
+ */
+
+#ifndef TIMSORT_H_
+#define TIMSORT_H_
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+#include "SortingDataTypes.h"
+#include "SortingUtilities.h"
+#include "ScratchBuffer.h"
+#include "MergeSort.h"
+
+/*
+ * 	TimSort is a stable natural merge sort.  It walks the array once,
+ * 	finding the runs that are already in order.  A strictly descending
+ * 	run is reversed in place.  A run shorter than the minimum run length
+ * 	is extended with a binary insertion sort.  Each run is pushed onto a
+ * 	stack, and runs on the top of the stack are merged whenever
+ *
+ * 		runs[n-2].size <= runs[n-1].size + runs[n].size	or
+ * 		runs[n-1].size <= runs[n].size
+ *
+ * 	which keeps the merges balanced and the stack shallow.  The merges
+ * 	gallop when one run supplies many elements in a row.
+ *
+ * 	An array that is already in order is a single run, and an array in
+ * 	reverse order is a single descending run, so both take n-1 compares.
+ * 	An array with a few elements out of place is a few long runs that
+ * 	are merged mostly by galloping.
+ *
+ * 	PowerSort (Munro & Wild, 2018) finds the same runs and uses the same
+ * 	merges, but decides which runs to merge differently.  Each boundary
+ * 	between two neighbouring runs gets a 'power', the depth at which the
+ * 	boundary would be in a perfectly balanced merge tree of the whole
+ * 	array.  Runs are merged while the boundary below the top of the stack
+ * 	is deeper than the new boundary.  The total cost of the merges is
+ * 	within n compares of the best possible for the runs, which TimSort's
+ * 	rules do not guarantee.
+ */
+
+namespace TimSort {
+
+	//	Arrays shorter than this are sorted with a binary insertion sort.
+	//	  The minimum run length is between half of this and this
+	constexpr array_size_t max_min_run = 64;
+
+	//	A run of the array, [start:start+size-1]
+	struct Run {
+		array_size_t start;
+		array_size_t size;
+		int			 power = 0;	// PowerSort:  of the boundary after the run
+	};
+
+	//	The rules that decide which runs on the stack to merge
+	enum class MergePolicy {
+		TIM_SORT,
+		POWER_SORT,
+	};
+
+	/*	**********************************************************	*/
+	/*						function declarations					*/
+	/*	**********************************************************	*/
+
+	// Declare the functions with default parameter for SortMetrics*
+	template <typename T, typename Metrics = SortMetrics>
+	void sort(T* array, array_size_t size, Metrics *metrics = nullptr);
+
+	template <typename T, typename Metrics = SortMetrics>
+	void sort(T* array, array_size_t size, ScratchBuffer<T> &scratch,
+			  Metrics *metrics = nullptr);
+
+	template <typename T, typename Metrics = SortMetrics>
+	void sort(T* array, array_size_t size, MergePolicy policy,
+			  Metrics *metrics = nullptr);
+
+	template <typename T, typename Metrics = SortMetrics>
+	void powerSort(T* array, array_size_t size, Metrics *metrics = nullptr);
+
+	template <typename T, typename Metrics = SortMetrics>
+	void powerSort(T* array, array_size_t size, ScratchBuffer<T> &scratch,
+				   Metrics *metrics = nullptr);
+
+	//	Returns the end of the next run, extended to 'min_run' if it is short
+	template <typename T, typename Metrics = SortMetrics>
+	array_size_t nextRun(T* array, array_size_t start, array_size_t size,
+						 array_size_t min_run, Metrics *metrics = nullptr);
+
+	//	Merges runs[i] and runs[i+1], which replace them on the stack
+	template <typename T, typename Metrics = SortMetrics>
+	void mergeAt(T* array, std::vector<Run> &runs, size_t i, T* aux,
+				 array_size_t &gallop_threshold, Metrics *metrics = nullptr);
+
+	//	Merges the top of the stack until the invariants hold
+	template <typename T, typename Metrics = SortMetrics>
+	void mergeCollapse(T* array, std::vector<Run> &runs, T* aux,
+					   array_size_t &gallop_threshold, Metrics *metrics = nullptr);
+
+	//	Merges every run on the stack into one
+	template <typename T, typename Metrics = SortMetrics>
+	void mergeForceCollapse(T* array, std::vector<Run> &runs, T* aux,
+							array_size_t &gallop_threshold, Metrics *metrics = nullptr);
+
+	inline array_size_t minRunLength(array_size_t size);
+
+	//	The power of the boundary between [start:start+left_size-1]
+	//	  and the run of 'right_size' that follows it
+	inline int nodePower(array_size_t start, array_size_t left_size,
+						 array_size_t right_size, array_size_t size);
+
+
+	/*	**********************************************************	*/
+	/*						function definitions					*/
+	/*	**********************************************************	*/
+
+	template <typename T, typename Metrics>
+	void sort(T* array, array_size_t size, Metrics *metrics) {
+
+		sort(array, size, ScratchBuffer<T>::forThisThread(), metrics);
+	}
+
+	template <typename T, typename Metrics>
+	void sort(T* array, array_size_t size, MergePolicy policy,
+			  Metrics *metrics) {
+
+		switch (policy) {
+		case MergePolicy::POWER_SORT:
+			powerSort(array, size, metrics);
+			break;
+		case MergePolicy::TIM_SORT:
+		default:
+			sort(array, size, metrics);
+			break;
+		}
+	}
+
+	template <typename T, typename Metrics>
+	void sort(T* array, array_size_t size, ScratchBuffer<T> &scratch,
+			  Metrics *metrics) {
+
+		if (size <= 1)
+			return;
+
+		if (size < max_min_run) {
+			array_size_t run_stop = MergeSort::findRun(array, 0, size, metrics);
+			MergeSort::binaryInsertionSort(array, 0, run_stop, size, metrics);
+			return;
+		}
+
+		// a merge copies out the smaller of its two runs
+		ScratchLease<T> aux(size/2, &scratch);
+
+		std::vector<Run> runs;
+		array_size_t gallop_threshold 	= MergeSort::initial_gallop_threshold;
+		array_size_t min_run			= minRunLength(size);
+
+		array_size_t start = 0;
+		while (start != size) {
+			array_size_t stop = nextRun(array, start, size, min_run, metrics);
+			runs.push_back({start, stop - start});
+			mergeCollapse(array, runs, aux.get(), gallop_threshold, metrics);
+			start = stop;
+		}
+		mergeForceCollapse(array, runs, aux.get(), gallop_threshold, metrics);
+		return;
+	}
+
+	template <typename T, typename Metrics>
+	void powerSort(T* array, array_size_t size, Metrics *metrics) {
+
+		powerSort(array, size, ScratchBuffer<T>::forThisThread(), metrics);
+	}
+
+	template <typename T, typename Metrics>
+	void powerSort(T* array, array_size_t size, ScratchBuffer<T> &scratch,
+				   Metrics *metrics) {
+
+		if (size <= 1)
+			return;
+
+		if (size < max_min_run) {
+			array_size_t run_stop = MergeSort::findRun(array, 0, size, metrics);
+			MergeSort::binaryInsertionSort(array, 0, run_stop, size, metrics);
+			return;
+		}
+
+		ScratchLease<T> aux(size/2, &scratch);
+
+		std::vector<Run> runs;
+		array_size_t gallop_threshold 	= MergeSort::initial_gallop_threshold;
+		array_size_t min_run			= minRunLength(size);
+
+		array_size_t start = 0;
+		while (start != size) {
+			array_size_t stop = nextRun(array, start, size, min_run, metrics);
+			if (!runs.empty()) {
+				Run &top  = runs.back();
+				int power = nodePower(top.start, top.size, stop - start, size);
+				// merge the runs whose boundary is deeper than the new one
+				while (runs.size() > 1 && runs[runs.size()-2].power > power) {
+					mergeAt(array, runs, runs.size()-2, aux.get(), gallop_threshold, metrics);
+				}
+				runs.back().power = power;
+			}
+			runs.push_back({start, stop - start});
+			start = stop;
+		}
+		// the powers on the stack increase toward the top
+		while (runs.size() > 1) {
+			mergeAt(array, runs, runs.size()-2, aux.get(), gallop_threshold, metrics);
+		}
+		return;
+	}
+
+	template <typename T, typename Metrics>
+	array_size_t nextRun(T* array, array_size_t start, array_size_t size,
+						 array_size_t min_run, Metrics *metrics) {
+
+		array_size_t stop = MergeSort::findRun(array, start, size, metrics);
+		if (stop - start < min_run) {
+			array_size_t forced_stop = start + min_run < size ? start + min_run : size;
+			MergeSort::binaryInsertionSort(array, start, stop, forced_stop, metrics);
+			stop = forced_stop;
+		}
+		return stop;
+	}
+
+	template <typename T, typename Metrics>
+	void mergeAt(T* array, std::vector<Run> &runs, size_t i, T* aux,
+				 array_size_t &gallop_threshold, Metrics *metrics) {
+
+		Run &lower = runs[i];
+		Run &upper = runs[i+1];
+		MergeSort::mergeAdjacentRuns(array, lower.start, upper.start,
+									 upper.start + upper.size, aux,
+									 gallop_threshold, metrics);
+		lower.size += upper.size;
+		runs.erase(runs.begin() + i + 1);
+	}
+
+	/*
+	 * 	The first condition is checked one run deeper than it was in the
+	 * 	original TimSort, which could leave the invariant broken below the
+	 * 	top of the stack (de Gouw et al., 2015)
+	 */
+
+	template <typename T, typename Metrics>
+	void mergeCollapse(T* array, std::vector<Run> &runs, T* aux,
+					   array_size_t &gallop_threshold, Metrics *metrics) {
+
+		while (runs.size() > 1) {
+			size_t n = runs.size() - 2;
+			if ((n > 0 && runs[n-1].size <= runs[n].size + runs[n+1].size) ||
+				(n > 1 && runs[n-2].size <= runs[n-1].size + runs[n].size)) {
+				// merge the middle run with the smaller of its neighbours
+				if (runs[n-1].size < runs[n+1].size) {
+					n--;
+				}
+			} else if (runs[n].size > runs[n+1].size) {
+				break;
+			}
+			mergeAt(array, runs, n, aux, gallop_threshold, metrics);
+		}
+	}
+
+	template <typename T, typename Metrics>
+	void mergeForceCollapse(T* array, std::vector<Run> &runs, T* aux,
+							array_size_t &gallop_threshold, Metrics *metrics) {
+
+		while (runs.size() > 1) {
+			size_t n = runs.size() - 2;
+			if (n > 0 && runs[n-1].size < runs[n+1].size) {
+				n--;
+			}
+			mergeAt(array, runs, n, aux, gallop_threshold, metrics);
+		}
+	}
+
+	/*
+	 * 	Returns a length between max_min_run/2 and max_min_run such that
+	 * 	size/min_run is a power of 2 or a little less than one, so that
+	 * 	the final merges are between runs of nearly equal size
+	 */
+
+	inline array_size_t minRunLength(array_size_t size) {
+
+		array_size_t low_bits = 0;
+		while (size >= max_min_run) {
+			low_bits |= size & 1;
+			size >>= 1;
+		}
+		return size + low_bits;
+	}
+
+	/*
+	 * 	The midpoints of the two runs, as fractions of the array, are
+	 * 	a/2n and b/2n.  The power is the position of the first bit where
+	 * 	the binary fractions differ, found one bit at a time by long
+	 * 	division, as in CPython's listsort.
+	 */
+
+	inline int nodePower(array_size_t start, array_size_t left_size,
+						 array_size_t right_size, array_size_t size) {
+
+		array_size_t a = 2*start + left_size;
+		array_size_t b = a + left_size + right_size;
+		int power = 0;
+		while (true) {
+			power++;
+			if (a >= size) {
+				// both bits are 1
+				a -= size;
+				b -= size;
+			} else if (b >= size) {
+				// the bits differ
+				break;
+			}
+			a <<= 1;
+			b <<= 1;
+		}
+		return power;
+	}
+}
+
+#endif /* TIMSORT_H_ */
@@ -0,0 +1,160 @@
+/*
+ * WorkStealingPool.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Joe Baker
+ */
+
+#include "WorkStealingPool.h"
+
+/* ************************************************************	*/
+/*					construction & destruction					*/
+/* ************************************************************	*/
+
+WorkStealingPool::WorkStealingPool(int num_workers) :
+	m_num_queued(0),
+	m_num_pending(0),
+	m_stopping(false)
+{
+	if (num_workers < 1) {
+		num_workers = 1;
+	}
+	for (int i = 0; i != num_workers; i++) {
+		m_queues.emplace_back(new WorkerQueue);
+	}
+	//	worker 0 is whichever thread calls run()
+	for (int i = 1; i != num_workers; i++) {
+		m_threads.emplace_back(&WorkStealingPool::workerLoop, this, i);
+	}
+}
+
+WorkStealingPool::~WorkStealingPool() {
+	{
+		std::lock_guard<std::mutex> lock(m_idle_mutex);
+		m_stopping = true;
+	}
+	m_idle_cv.notify_all();
+	for (auto& thread : m_threads) {
+		thread.join();
+	}
+}
+
+WorkStealingPool& WorkStealingPool::shared(void) {
+	static WorkStealingPool pool(
+			static_cast<int>(std::thread::hardware_concurrency()));
+	return pool;
+}
+
+int WorkStealingPool::numWorkers(void) const {
+	return static_cast<int>(m_queues.size());
+}
+
+/* ************************************************************	*/
+/*						running tasks							*/
+/* ************************************************************	*/
+
+void WorkStealingPool::run(Task task) {
+
+	std::lock_guard<std::mutex> run_lock(m_run_mutex);
+
+	push(0, std::move(task));
+
+	while (m_num_pending.load() != 0) {
+		if (runOneTask(0)) {
+			continue;
+		}
+		std::unique_lock<std::mutex> lock(m_idle_mutex);
+		m_idle_cv.wait(lock, [this] {
+			return m_num_queued.load() != 0 || m_num_pending.load() == 0;
+		});
+	}
+}
+
+void WorkStealingPool::push(int worker_id, Task task) {
+
+	m_num_pending++;
+	{
+		WorkerQueue& queue = *m_queues[worker_id];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		queue.tasks.push_back(std::move(task));
+	}
+	m_num_queued++;
+	notifyIdle(false);
+}
+
+void WorkStealingPool::workerLoop(int worker_id) {
+
+	while (true) {
+		if (runOneTask(worker_id)) {
+			continue;
+		}
+		std::unique_lock<std::mutex> lock(m_idle_mutex);
+		m_idle_cv.wait(lock, [this] {
+			return m_stopping || m_num_queued.load() != 0;
+		});
+		if (m_stopping) {
+			return;
+		}
+	}
+}
+
+//	Returns false if there was no task to run
+bool WorkStealingPool::runOneTask(int worker_id) {
+
+	Task task;
+	if (!popOwn(worker_id, task) && !steal(worker_id, task)) {
+		return false;
+	}
+	m_num_queued--;
+	task(worker_id);
+	if (--m_num_pending == 0) {
+		//	wake worker 0, which is waiting in run()
+		notifyIdle(true);
+	}
+	return true;
+}
+
+/* ************************************************************	*/
+/*						deque access							*/
+/* ************************************************************	*/
+
+bool WorkStealingPool::popOwn(int worker_id, Task& task) {
+
+	WorkerQueue& queue = *m_queues[worker_id];
+	std::lock_guard<std::mutex> lock(queue.mutex);
+	if (queue.tasks.empty()) {
+		return false;
+	}
+	task = std::move(queue.tasks.back());
+	queue.tasks.pop_back();
+	return true;
+}
+
+bool WorkStealingPool::steal(int worker_id, Task& task) {
+
+	int num_workers = numWorkers();
+	for (int i = 1; i != num_workers; i++) {
+		WorkerQueue& queue = *m_queues[(worker_id + i) % num_workers];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (queue.tasks.empty()) {
+			continue;
+		}
+		task = std::move(queue.tasks.front());
+		queue.tasks.pop_front();
+		return true;
+	}
+	return false;
+}
+
+//	Taking the lock before notifying keeps a waiter from missing the
+//	  change between testing its predicate and going to sleep
+void WorkStealingPool::notifyIdle(bool all) {
+	{
+		std::lock_guard<std::mutex> lock(m_idle_mutex);
+	}
+	if (all) {
+		m_idle_cv.notify_all();
+	} else {
+		m_idle_cv.notify_one();
+	}
+}
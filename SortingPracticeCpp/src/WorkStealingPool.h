@@ -0,0 +1,101 @@
+/*
+ * WorkStealingPool.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Joe Baker
+ */
+
+/*	A pool of threads for fork / join style recursive work, such as
+ *	  the two halves of a quick sort partition.
+ *
+ *	Each worker has its own deque of tasks.  A worker pushes new tasks
+ *	  onto the back of its own deque and pops from the back, so it works
+ *	  on the most recently split, and smallest, piece first.  A worker
+ *	  whose deque is empty steals from the front of another worker's
+ *	  deque, which is where the oldest, and largest, pieces are.
+ *
+ *	The thread that calls run() acts as worker 0 until every task,
+ *	  including the tasks pushed by other tasks, has finished.
+ */
+
+#ifndef WORKSTEALINGPOOL_H_
+#define WORKSTEALINGPOOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class WorkStealingPool {
+public:
+	//	The argument is the id of the worker running the task, [0:numWorkers())
+	using Task = std::function<void(int)>;
+
+	//	num_workers includes the thread that calls run()
+	explicit WorkStealingPool(int num_workers);
+	~WorkStealingPool();
+
+	WorkStealingPool(const WorkStealingPool&) = delete;
+	WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+	int numWorkers(void) const;
+
+	//	Runs 'task' and everything it pushes.  Returns when all are done.
+	//	  Only one run() is active at a time; other callers wait their turn
+	void run(Task task);
+
+	//	Called from within a task to hand work to the pool
+	void push(int worker_id, Task task);
+
+	//	A pool with one worker per hardware thread, created on first use
+	static WorkStealingPool& shared(void);
+
+private:
+	struct WorkerQueue {
+		std::mutex			mutex;
+		std::deque<Task>	tasks;
+	};
+
+	std::vector<std::unique_ptr<WorkerQueue>>	m_queues;
+	std::vector<std::thread>					m_threads;
+
+	std::atomic<long>	m_num_queued;		// pushed but not yet started
+	std::atomic<long>	m_num_pending;		// pushed but not yet finished
+	bool				m_stopping;
+
+	std::mutex				m_idle_mutex;	// guards m_stopping & waiting
+	std::condition_variable	m_idle_cv;
+	std::mutex				m_run_mutex;	// one run() at a time
+
+	bool popOwn(int worker_id, Task& task);
+	bool steal(int worker_id, Task& task);
+	bool runOneTask(int worker_id);
+	void workerLoop(int worker_id);
+	void notifyIdle(bool all);
+};
+
+/*	One value per worker, such as the SortMetrics that each worker
+ *	  accumulates during a parallel sort.  Each value is on its own
+ *	  cache line so that workers do not slow each other down
+ */
+
+template <typename V>
+class PerWorker {
+private:
+	struct alignas(64) Slot {
+		V value;
+	};
+	std::vector<Slot> m_slots;
+
+public:
+	explicit PerWorker(int num_workers) : m_slots(num_workers) {}
+
+	V& operator[](int worker_id) 	{	return m_slots[worker_id].value;	}
+	int size(void) const			{	return static_cast<int>(m_slots.size());	}
+};
+
+#endif /* WORKSTEALINGPOOL_H_ */